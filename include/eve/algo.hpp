@@ -24,34 +24,50 @@
 #include <eve/algo/any_of.hpp>
 #include <eve/algo/array_utils.hpp>
 #include <eve/algo/as_range.hpp>
+#include <eve/algo/byte_classifier.hpp>
 #include <eve/algo/common_forceinline_lambdas.hpp>
 #include <eve/algo/concepts.hpp>
 #include <eve/algo/copy.hpp>
+#include <eve/algo/copy_if.hpp>
 #include <eve/algo/equal.hpp>
+#include <eve/algo/exclusive_scan.hpp>
 #include <eve/algo/fill.hpp>
+#include <eve/algo/find_first_of.hpp>
 #include <eve/algo/find_last.hpp>
 #include <eve/algo/find.hpp>
 #include <eve/algo/for_each_iteration.hpp>
 #include <eve/algo/for_each.hpp>
+#include <eve/algo/histogram.hpp>
 #include <eve/algo/inclusive_scan.hpp>
 #include <eve/algo/iota.hpp>
 #include <eve/algo/iterator_helpers.hpp>
+#include <eve/algo/lower_bound_batch.hpp>
 #include <eve/algo/max_element.hpp>
 #include <eve/algo/max_value.hpp>
 #include <eve/algo/min_element.hpp>
 #include <eve/algo/min_value.hpp>
 #include <eve/algo/mismatch.hpp>
 #include <eve/algo/none_of.hpp>
+#include <eve/algo/partition.hpp>
 #include <eve/algo/preprocess_range.hpp>
 #include <eve/algo/ptr_iterator.hpp>
+#include <eve/algo/radix_sort.hpp>
 #include <eve/algo/range_ref.hpp>
 #include <eve/algo/reduce.hpp>
 #include <eve/algo/remove.hpp>
 #include <eve/algo/reverse.hpp>
+#include <eve/algo/scan_by_key.hpp>
+#include <eve/algo/search.hpp>
+#include <eve/algo/set_operations.hpp>
+#include <eve/algo/sort.hpp>
+#include <eve/algo/split_positions.hpp>
 #include <eve/algo/swap_ranges.hpp>
+#include <eve/algo/thread_pool.hpp>
+#include <eve/algo/to_bitmask.hpp>
 #include <eve/algo/traits.hpp>
 #include <eve/algo/transform_reduce.hpp>
 #include <eve/algo/transform.hpp>
+#include <eve/algo/unique.hpp>
 #include <eve/views/backward.hpp>
 #include <eve/views/convert.hpp>
 #include <eve/views/iota.hpp>
@@ -0,0 +1,145 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+namespace eve::algo
+{
+//================================================================================================
+//! @addtogroup algos
+//! @{
+//!  @struct byte_classifier
+//!  @brief Predicate testing if bytes belong to a set, with two nibble tables lookups
+//!
+//!  A byte `b` belongs to the set if `low[b & 15] & high[b >> 4]` is not zero.
+//!  Every high nibble has a bit (`1 << (b >> 4) % 8`) and the low table has that bit set for
+//!  the bytes of the set. As there are only 8 bits, high nibbles from 8 to 15 use their own low
+//!  table, so any set of bytes is classified exactly.
+//!
+//!  The tables are computed once, at construction (possibly at compile time), and are looked up
+//!  with eve::lookup on 16 bytes pieces of the input (`pshufb`/`tbl`).
+//!
+//!  Can be used as a predicate by any algorithm, on wides of 8 bits integers.
+//!
+//!   **Alternative Header**
+//!
+//!   @code
+//!   #include <eve/algo.hpp>
+//!   @endcode
+//!
+//!   @groupheader{Member functions}
+//!
+//!   @code
+//!   namespace eve::algo
+//!   {
+//!     struct byte_classifier
+//!     {
+//!       constexpr byte_classifier();  // empty set
+//!       constexpr byte_classifier(std::initializer_list<std::uint8_t> bytes);
+//!       constexpr explicit byte_classifier(std::string_view bytes);
+//!
+//!       // Adds `b` to the set
+//!       constexpr void add(std::uint8_t b);
+//!
+//!       // Is `b` in the set
+//!       constexpr bool contains(std::uint8_t b) const;
+//!
+//!       // Which lanes of `x` are in the set
+//!       template <eve::simd_value Wide> eve::as_logical_t<Wide> operator()(Wide x) const;
+//!     };
+//!   }
+//!   @endcode
+//!
+//!   @groupheader{Example}
+//!
+//!   @godbolt{doc/algo/find_first_of.cpp}
+//!
+//!   @see find_first_of
+//!   @see to_bitmask
+//! @}
+//================================================================================================
+struct byte_classifier
+{
+  static constexpr std::size_t table_size = 16;
+  using table_t                           = std::array<std::uint8_t, table_size>;
+
+  alignas(table_size) table_t low_lo {};  // low nibble -> bits of the high nibbles 0..7
+  alignas(table_size) table_t low_hi {};  // low nibble -> bits of the high nibbles 8..15
+  alignas(table_size) table_t high {};    // high nibble -> its bit
+
+  constexpr byte_classifier() { init(); }
+
+  constexpr byte_classifier(std::initializer_list<std::uint8_t> bytes)
+  {
+    init();
+    for( std::uint8_t b : bytes ) add(b);
+  }
+
+  constexpr explicit byte_classifier(std::string_view bytes)
+  {
+    init();
+    for( char c : bytes ) add(static_cast<std::uint8_t>(c));
+  }
+
+  constexpr void add(std::uint8_t b)
+  {
+    auto& low = b < 128 ? low_lo : low_hi;
+    low[b & 15] |= high[b >> 4];
+  }
+
+  constexpr bool contains(std::uint8_t b) const
+  {
+    auto const& low = b < 128 ? low_lo : low_hi;
+    return (low[b & 15] & high[b >> 4]) != 0;
+  }
+
+  template<eve::simd_value Wide> EVE_FORCEINLINE auto operator()(Wide x) const
+  {
+    using e_t = eve::element_type_t<Wide>;
+    using N   = eve::cardinal_t<Wide>;
+    using u8  = eve::wide<std::uint8_t, N>;
+
+    static_assert(std::integral<e_t> && sizeof(e_t) == 1, "eve::algo::byte_classifier works on bytes");
+
+    u8 u  = eve::bit_cast(x, eve::as<u8> {});
+    u8 lo = u & std::uint8_t {15};
+    u8 hi = u >> 4;
+
+    u8 bits = eve::if_else(hi < std::uint8_t {8}, lookup(low_lo, lo), lookup(low_hi, lo));
+    return eve::bit_cast(eve::is_nez(bits & lookup(high, hi)), eve::as<eve::as_logical_t<Wide>> {});
+  }
+
+  private:
+  constexpr void init()
+  {
+    for( std::size_t i = 0; i != table_size; ++i ) high[i] = static_cast<std::uint8_t>(1 << (i % 8));
+  }
+
+  // Every index is below 16: a table of 16 lanes is looked up with an in-register shuffle,
+  // wider indexes are split in pieces of 16 lanes. Smaller wides can't hold the table.
+  template<typename N>
+  EVE_FORCEINLINE static auto lookup(table_t const& t, eve::wide<std::uint8_t, N> idx)
+  {
+    using u8 = eve::wide<std::uint8_t, N>;
+
+    if constexpr( N::value == 16 ) return eve::lookup(u8(eve::aligned_ptr<std::uint8_t const, N>(t.data())), idx);
+    else if constexpr( N::value > 16 )
+    {
+      auto [lo, hi] = idx.slice();
+      return u8(lookup(t, lo), lookup(t, hi));
+    }
+    else return eve::gather(t.data(), idx);
+  }
+};
+}
@@ -0,0 +1,178 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/array_utils.hpp>
+#include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/for_each_iteration.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <array>
+
+namespace eve::algo
+{
+  template <typename TraitsSupport>
+  struct transform_copy_if_ : TraitsSupport
+  {
+    template <typename UnalignedO, typename P, typename Op>
+    struct delegate
+    {
+      delegate(UnalignedO out, P p, Op op) : out(out), p(p), op(op) {}
+
+      EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+      {
+        auto loaded = eve::load[ignore](it);
+        auto mask   = eve::replace_ignored(p(loaded), ignore, false);
+        auto values = eve::convert(op(loaded), eve::as<value_type_t<UnalignedO>>{});
+
+        // We don't own the memory after the output, so the store has to be exact.
+        out = safe(compress_store)(values, mask, out);
+        return false;
+      }
+
+      template <typename I, std::size_t size>
+      EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+      {
+        array_map(arr, call_single_step(this));
+        return false;
+      }
+
+      UnalignedO out;
+      P          p;
+      Op         op;
+    };
+
+    template <relaxed_range Rng, relaxed_iterator O, typename P, typename Op>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, O out, P p, Op op) const
+    {
+      if (rng.begin() == rng.end()) return out;
+
+      // zip is only used to agree on the cardinal, the output is advanced separately.
+      auto processed = preprocess_range(TraitsSupport::get_traits(), views::zip(EVE_FWD(rng), out));
+
+      auto f = processed.begin();
+      auto l = processed.end();
+
+      auto first = unalign(get<1>(f));
+
+      auto iteration = algo::for_each_iteration(processed.traits(), get<0>(f), get<0>(l));
+      delegate<decltype(first), P, Op> d{first, p, op};
+      iteration(d);
+
+      return out + (d.out - first);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var transform_copy_if
+  //!  @brief Writes `op(x)` for every element `x` of the input that satisfies the predicate
+  //!
+  //!  Equivalent to `copy_if` followed by `transform_inplace` on the output,
+  //!  but does a single pass and never loads the output.
+  //!  If the result of `op` differs from the output type, converts.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, relaxed_iterator O, typename P, typename Op>
+  //!     O transform_copy_if(Rng&& rng, O out, P p, Op op);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range to process
+  //!    * `out`: Relaxed iterator to the beginning of the destination
+  //!    * `p`: Predicate applied to the input, taking a wide and returning a logical
+  //!    * `op`: Operation applied to the input elements that are kept
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator past the last element written.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/copy_if.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto transform_copy_if = function_with_traits<transform_copy_if_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct copy_if_ : TraitsSupport
+  {
+    template <relaxed_range Rng, relaxed_iterator O, typename P>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, O out, P p) const
+    {
+      return transform_copy_if[TraitsSupport::get_traits()](EVE_FWD(rng), out, p, do_nothing{});
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var copy_if
+  //!  @brief SIMD version of std::copy_if
+  //!
+  //!  Copies the elements that satisfy the predicate to `out`, preserving their order.
+  //!  Unlike eve::algo::remove_if, the input is not modified.
+  //!
+  //!  To filter several columns with the same predicate in one pass, pass
+  //!  `eve::views::zip` of the columns as the input and of the destinations as the output.
+  //!  The predicate then receives a wide of tuples.
+  //!
+  //!  @note
+  //!         * Only the elements written are touched in the output.
+  //!         * If the input and output types differ, converts.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, relaxed_iterator O, typename P>
+  //!     O copy_if(Rng&& rng, O out, P p);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range to process
+  //!    * `out`: Relaxed iterator to the beginning of the destination
+  //!    * `p`: Predicate taking a wide and returning a logical
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator past the last element written.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/copy_if.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto copy_if = function_with_traits<copy_if_>[default_simple_algo_traits];
+}
@@ -0,0 +1,125 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/thread_pool.hpp>
+#include <eve/algo/traits.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace eve::algo::detail
+{
+  template <typename Traits>
+  thread_pool& get_thread_pool(Traits const& tr)
+  {
+    thread_pool* pool = tr[thread_pool_key | static_cast<thread_pool*>(nullptr)];
+    return pool ? *pool : global_thread_pool();
+  }
+
+  // Splits [f, l) into subranges that are processed on a thread pool.
+  //
+  // Subranges are described by their unaligned boundaries.
+  // Inner boundaries are placed at a multiple of the cardinal (and at least of a cache line)
+  // from where the sequential iteration would have started, so each subrange does the same
+  // aligned loads and stores that the single threaded algorithm would have done.
+  template <typename Traits, typename I>
+  struct parallel_iteration
+  {
+    using unaligned_i = unaligned_t<I>;
+    using seq_traits  = decltype(drop_key(parallel, std::declval<Traits>()));
+
+    template <typename S>
+    parallel_iteration(Traits tr, I f, S l) : traits_(drop_key(parallel, tr)), pool_(&get_thread_pool(tr))
+    {
+      using v_t = value_type_t<I>;
+
+      constexpr std::ptrdiff_t card = iterator_cardinal_v<I>;
+      constexpr std::ptrdiff_t step = []
+      {
+        std::ptrdiff_t s = card;
+        while( s * static_cast<std::ptrdiff_t>(sizeof(v_t)) < 64 ) s *= 2;
+        return s;
+      }();
+      constexpr std::ptrdiff_t job_size = get_parallel_job_size<Traits>() ? get_parallel_job_size<Traits>()
+                                                                          : std::max(65536 / std::ptrdiff_t(sizeof(v_t)), std::ptrdiff_t{1});
+
+      unaligned_i uf   = unalign(f);
+      unaligned_i base = uf;
+      if constexpr( !Traits::contains(no_aligning) && !partially_aligned_iterator<I> )
+      {
+        base = unalign(f.previous_partially_aligned());
+      }
+
+      std::ptrdiff_t total     = (l - f) + (uf - base);
+      std::ptrdiff_t max_parts = pool_->concurrency() == 1 ? 1 : 4 * pool_->concurrency();
+      std::ptrdiff_t parts     = std::clamp(total / job_size, std::ptrdiff_t{1}, max_parts);
+      std::ptrdiff_t chunk     = (total + parts - 1) / parts;
+      chunk                    = (chunk + step - 1) / step * step;
+
+      bounds_.push_back(uf);
+      for( std::ptrdiff_t pos = chunk; pos < total; pos += chunk ) bounds_.push_back(base + pos);
+      bounds_.push_back(uf + (l - f));
+    }
+
+    seq_traits  traits() const { return traits_; }
+    std::size_t size()   const { return bounds_.size() - 1; }
+
+    // Calls op(i, traits(), f_i, l_i) for each subrange on the thread pool.
+    template <typename Op> void operator()(Op op) const
+    {
+      pool_->run(size(), [&](std::size_t i) { op(i, traits_, bounds_[i], bounds_[i + 1]); });
+    }
+
+    unaligned_i begin(std::size_t i) const { return bounds_[i]; }
+    unaligned_i end  (std::size_t i) const { return bounds_[i + 1]; }
+
+    private:
+    seq_traits               traits_;
+    thread_pool*             pool_;
+    std::vector<unaligned_i> bounds_;
+  };
+
+  template <typename Traits, typename I, typename S>
+  parallel_iteration(Traits, I, S) -> parallel_iteration<Traits, I>;
+
+  inline void atomic_min(std::atomic<std::size_t>& x, std::size_t v)
+  {
+    std::size_t cur = x.load(std::memory_order_relaxed);
+    while( v < cur && !x.compare_exchange_weak(cur, v, std::memory_order_relaxed) ) {}
+  }
+
+  // Stops the iteration of the subrange `idx` as soon as a previous subrange reported
+  // a result to `first`.
+  template <typename Delegate>
+  struct cancellable_delegate
+  {
+    Delegate&                       d;
+    std::atomic<std::size_t> const& first;
+    std::size_t                     idx;
+
+    EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto i)
+    {
+      if( first.load(std::memory_order_relaxed) < idx ) return true;
+      return d.step(it, ignore, i);
+    }
+
+    template <typename It, std::size_t size>
+    EVE_FORCEINLINE bool unrolled_step(std::array<It, size> arr)
+    {
+      if( first.load(std::memory_order_relaxed) < idx ) return true;
+      return d.unrolled_step(arr);
+    }
+  };
+
+  template <typename Delegate>
+  cancellable_delegate(Delegate&, std::atomic<std::size_t> const&, std::size_t) -> cancellable_delegate<Delegate>;
+}
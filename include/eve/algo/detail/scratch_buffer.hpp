@@ -0,0 +1,25 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/algo/container/soa_vector.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace eve::algo::detail
+{
+  // Uninitialized (when possible) temporary storage for `n` elements of `T`.
+  // Product types are stored as a structure of arrays, so that the buffer can be
+  // used with the same iterators as the range it mirrors.
+  template<typename T> auto make_scratch_buffer(std::ptrdiff_t n)
+  {
+    if constexpr( kumi::product_type<T> ) return soa_vector<T>(no_init, n);
+    else                                  return std::vector<T>(n);
+  }
+}
@@ -0,0 +1,149 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/algo/inclusive_scan.hpp>
+
+namespace eve::algo
+{
+  template <typename TraitsSupport>
+  struct exclusive_scan_inplace_ : TraitsSupport
+  {
+    template <relaxed_range Rng, typename Op, typename Zero, typename U>
+    EVE_FORCEINLINE void operator()(Rng&& rng, std::pair<Op, Zero> op_zero, U init) const
+    {
+      detail::scan_common<inplace_load_store, true>{}(
+        TraitsSupport::get_traits(), views::convert(EVE_FWD(rng), eve::as<U>{}), op_zero, init);
+    }
+
+    template <relaxed_range Rng, typename U>
+    EVE_FORCEINLINE void operator()(Rng&& rng, U init) const
+    {
+      operator()(EVE_FWD(rng), std::pair{eve::plus, eve::zero}, init);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var exclusive_scan_inplace
+  //!  @brief SIMD version of std::exclusive_scan, writing to the input
+  //!
+  //!  Element `i` becomes `init` combined with the elements before `i` (not including it).
+  //!  Same in register eve::scan as eve::algo::inclusive_scan_inplace, the result is slid
+  //!  by one lane behind the running sum.
+  //!
+  //!  Any associative operation can be used, with its identity as the `zero`:
+  //!  `{eve::plus, eve::zero}`, `{eve::max, eve::valmin}`, `{eve::min, eve::valmax}`,
+  //!  `{eve::bit_or, eve::zero}`...
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, typename Op, typename Zero, typename U>
+  //!     void exclusive_scan_inplace(Rng&& rng, std::pair<Op, Zero> op_zero, U init);
+  //!
+  //!     template <relaxed_range Rng, typename U>
+  //!     void exclusive_scan_inplace(Rng&& rng, U init);  // {eve::plus, eve::zero}
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed range to scan, converted to `U`
+  //!    * `op_zero`: Associative operation and its identity
+  //!    * `init`: First value written
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/inclusive_scan.cpp}
+  //!
+  //!   @see exclusive_scan_to
+  //! @}
+  //================================================================================================
+  inline constexpr auto exclusive_scan_inplace = function_with_traits<exclusive_scan_inplace_>[no_traits];
+
+  template <typename TraitsSupport>
+  struct exclusive_scan_to_ : TraitsSupport
+  {
+    template <zipped_range_pair R, typename Op, typename Zero, typename U>
+    EVE_FORCEINLINE void operator()(R r, std::pair<Op, Zero> op_zero, U init) const
+    {
+      detail::scan_common<to_load_store, true>{}(
+        TraitsSupport::get_traits(), r[force_type<U>], op_zero, init);
+    }
+
+    template <zipped_range_pair R, typename U>
+    EVE_FORCEINLINE auto operator()(R r, U init) const
+    {
+      operator()(r, std::pair{eve::plus, eve::zero}, init);
+    }
+
+    template <typename R1, typename R2, typename Op, typename Zero, typename U>
+      requires zip_to_range<R1, R2>
+    EVE_FORCEINLINE auto operator()(R1&& r1, R2&& r2, std::pair<Op, Zero> op_zero, U init) const
+    {
+      operator()(views::zip(EVE_FWD(r1), EVE_FWD(r2)), op_zero, init);
+    }
+
+    template <typename R1, typename R2, typename U>
+      requires zip_to_range<R1, R2>
+    EVE_FORCEINLINE auto operator()(R1&& r1, R2&& r2, U init) const
+    {
+      return operator()(views::zip(EVE_FWD(r1), EVE_FWD(r2)), init);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var exclusive_scan_to
+  //!  @brief SIMD version of std::exclusive_scan
+  //!
+  //!  Same as eve::algo::exclusive_scan_inplace, reading from the first range
+  //!  and writing to the second one.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <zipped_range_pair R, typename Op, typename Zero, typename U>
+  //!     void exclusive_scan_to(R r, std::pair<Op, Zero> op_zero, U init);
+  //!
+  //!     template <typename R1, typename R2, typename Op, typename Zero, typename U>
+  //!       requires zip_to_range<R1, R2>
+  //!     void exclusive_scan_to(R1&& r1, R2&& r2, std::pair<Op, Zero> op_zero, U init);
+  //!
+  //!     // and the same without `op_zero` for {eve::plus, eve::zero}
+  //!   }
+  //!   @endcode
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/inclusive_scan.cpp}
+  //!
+  //!   @see exclusive_scan_inplace
+  //! @}
+  //================================================================================================
+  inline constexpr auto exclusive_scan_to = function_with_traits<exclusive_scan_to_>[no_traits];
+}
@@ -10,12 +10,15 @@
 #include <eve/algo/array_utils.hpp>
 #include <eve/algo/common_forceinline_lambdas.hpp>
 #include <eve/algo/concepts.hpp>
+#include <eve/algo/detail/parallel.hpp>
 #include <eve/algo/for_each_iteration.hpp>
 #include <eve/algo/preprocess_range.hpp>
 #include <eve/algo/traits.hpp>
 #include <eve/module/core.hpp>
 
 #include <array>
+#include <atomic>
+#include <vector>
 
 namespace eve::algo
 {
@@ -78,11 +81,36 @@ template<typename TraitsSupport> struct find_if_ : TraitsSupport
 
     auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
 
-    auto l = unalign(processed.begin()) + (processed.end() - processed.begin());
+    using UI = unaligned_t<decltype(processed.begin())>;
+    UI l     = unalign(processed.begin()) + (processed.end() - processed.begin());
 
-    delegate<unaligned_t<decltype(processed.begin())>, P> d {l, p};
-    algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
-    return unalign(rng.begin()) + (d.found - processed.begin());
+    if constexpr( decltype(processed.traits())::contains(parallel) )
+    {
+      // Subranges after the first match are cancelled.
+      detail::parallel_iteration iteration {processed.traits(), processed.begin(), processed.end()};
+      std::vector<UI>            found(iteration.size(), l);
+      std::atomic<std::size_t>   first {iteration.size()};
+
+      iteration(
+          [&](std::size_t i, auto tr, auto f, auto sub_l)
+          {
+            delegate<UI, P> d {sub_l, p};
+            detail::cancellable_delegate cd {d, first, i};
+            algo::for_each_iteration(tr, f, sub_l)(cd);
+            if( d.found == sub_l ) return;
+            found[i] = d.found;
+            detail::atomic_min(first, i);
+          });
+
+      if( first == iteration.size() ) return unalign(rng.begin()) + (l - processed.begin());
+      return unalign(rng.begin()) + (found[first] - processed.begin());
+    }
+    else
+    {
+      delegate<UI, P> d {l, p};
+      algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+      return unalign(rng.begin()) + (d.found - processed.begin());
+    }
   }
 };
 
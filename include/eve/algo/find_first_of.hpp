@@ -0,0 +1,123 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/algo/byte_classifier.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/find.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/module/core.hpp>
+
+#include <vector>
+
+namespace eve::algo
+{
+namespace detail
+{
+  // Tests every lane against every value: meant for a handful of values.
+  template<typename T> struct equal_to_any
+  {
+    std::vector<T> values;
+
+    EVE_FORCEINLINE auto operator()(auto x) const
+    {
+      auto res = eve::false_(eve::as(x));
+      for( T v : values ) res = res || (x == v);
+      return res;
+    }
+  };
+}
+
+template<typename TraitsSupport> struct find_first_of_ : TraitsSupport
+{
+  template<relaxed_range Rng>
+  EVE_FORCEINLINE auto operator()(Rng&& rng, byte_classifier const& set) const
+    -> unaligned_iterator_t<Rng>
+  {
+    return find_if[TraitsSupport::get_traits()](EVE_FWD(rng), set);
+  }
+
+  template<relaxed_range Rng, relaxed_range Values>
+  EVE_FORCEINLINE auto operator()(Rng&& rng, Values&& values) const
+    -> unaligned_iterator_t<Rng>
+  {
+    using T = value_type_t<Rng>;
+
+    auto f = unalign(preprocess_range(eve::algo::traits(), EVE_FWD(values)).begin());
+    std::ptrdiff_t m = values.end() - values.begin();
+
+    if constexpr( std::integral<T> && sizeof(T) == 1 )
+    {
+      byte_classifier set {};
+      for( std::ptrdiff_t i = 0; i != m; ++i ) set.add(static_cast<std::uint8_t>(eve::read(f + i)));
+      return operator()(EVE_FWD(rng), set);
+    }
+    else
+    {
+      detail::equal_to_any<T> p;
+      for( std::ptrdiff_t i = 0; i != m; ++i ) p.values.push_back(static_cast<T>(eve::read(f + i)));
+      return find_if[TraitsSupport::get_traits()](EVE_FWD(rng), p);
+    }
+  }
+};
+
+//================================================================================================
+//! @addtogroup algos
+//! @{
+//!  @var find_first_of
+//!
+//!  @brief SIMD version of std::find_first_of
+//!
+//!  Finds the first element that is equal to any of the values of a small set.
+//!
+//!  For bytes, the set is an eve::algo::byte_classifier: every wide is classified with two table
+//!  lookups whatever the size of the set. A range of values is turned into a classifier for bytes,
+//!  other types compare every element to every value.
+//!
+//!   **Alternative Header**
+//!
+//!   @code
+//!   #include <eve/algo.hpp>
+//!   @endcode
+//!
+//!   @groupheader{Callable Signatures}
+//!
+//!   @code
+//!   namespace eve::algo
+//!   {
+//!     template <eve::algo::relaxed_range Rng>
+//!     auto find_first_of(Rng&& rng, byte_classifier const& set) -> unaligned_iterator_t<Rng>; // 1
+//!
+//!     template <eve::algo::relaxed_range Rng, eve::algo::relaxed_range Values>
+//!     auto find_first_of(Rng&& rng, Values&& values) -> unaligned_iterator_t<Rng>;             // 2
+//!   }
+//!   @endcode
+//!
+//!   1. `rng` has to contain 8 bits integers. Precompute the classifier if it is reused.
+//!   2. Any element type. For bytes, builds a classifier.
+//!
+//!   **Parameters**
+//!
+//!    * `rng`: Relaxed input range to process
+//!    * `set`: Classifier for the bytes to find
+//!    * `values`: Relaxed range of the values to find
+//!
+//!   **Return value**
+//!
+//!   Iterator on the element found or past the end if not found (same as std)
+//!
+//!   @groupheader{Example}
+//!
+//!   @godbolt{doc/algo/find_first_of.cpp}
+//!
+//!   @see to_bitmask
+//! @}
+//================================================================================================
+inline constexpr auto find_first_of = function_with_traits<find_first_of_>[default_simple_algo_traits];
+}
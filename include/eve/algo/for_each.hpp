@@ -10,6 +10,7 @@
 #include <eve/module/core.hpp>
 #include <eve/algo/array_utils.hpp>
 #include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/detail/parallel.hpp>
 #include <eve/algo/for_each_iteration.hpp>
 #include <eve/algo/preprocess_range.hpp>
 #include <eve/algo/traits.hpp>
@@ -65,8 +66,19 @@ namespace eve::algo
       auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
       if( processed.begin() == processed.end() ) return;
 
-      delegate<Op> d{op};
-      algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+      if constexpr( decltype(processed.traits())::contains(parallel) )
+      {
+        detail::parallel_iteration iteration{processed.traits(), processed.begin(), processed.end()};
+        iteration([&](std::size_t, auto tr, auto f, auto l) {
+          delegate<Op> d{op};
+          algo::for_each_iteration(tr, f, l)(d);
+        });
+      }
+      else
+      {
+        delegate<Op> d{op};
+        algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+      }
     }
   };
 
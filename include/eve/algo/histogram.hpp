@@ -0,0 +1,170 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/array_utils.hpp>
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/for_each_iteration.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/transform.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace eve::algo
+{
+  namespace detail
+  {
+    struct histogram_add
+    {
+      EVE_FORCEINLINE auto operator()(auto bin_sub) const
+      {
+        auto [bin, sub] = bin_sub;
+        return bin + eve::convert(sub, eve::as<eve::element_type_t<decltype(bin)>>{});
+      }
+    };
+
+    // Sub histograms should stay in L1
+    inline constexpr std::size_t histogram_budget = 32 * 1024 / sizeof(std::uint32_t);
+  }
+
+  template <typename TraitsSupport>
+  struct histogram_ : TraitsSupport
+  {
+    template <typename N, typename BucketFn>
+    struct delegate
+    {
+      delegate(std::uint32_t* subs, std::uint32_t nbins, std::size_t nsubs, BucketFn bucket_fn)
+        : subs(subs), nbins(nbins), nsubs(nsubs), bucket_fn(bucket_fn)
+      {}
+
+      EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+      {
+        auto buckets = eve::convert(bucket_fn(eve::load[ignore](it)), eve::as<std::uint32_t>{});
+
+        // Ignored lanes and buckets out of range go to an extra bin, that is dropped at the end.
+        // Negative buckets became big unsigned values.
+        buckets = eve::min(eve::replace_ignored(buckets, ignore, nbins), nbins);
+
+        std::array<std::uint32_t, N::value> idxs;
+        eve::store(buckets, idxs.data());
+
+        // Every lane has its own sub histogram (modulo the number of them),
+        // so the lanes of one step never wait on each other's increments.
+        for( std::size_t i = 0; i != idxs.size(); ++i )
+        {
+          ++subs[(i & (nsubs - 1)) * (nbins + 1) + idxs[i]];
+        }
+        return false;
+      }
+
+      template <typename I, std::size_t size>
+      EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+      {
+        array_map(arr, call_single_step(this));
+        return false;
+      }
+
+      std::uint32_t* subs;
+      std::uint32_t  nbins;
+      std::size_t    nsubs;
+      BucketFn       bucket_fn;
+    };
+
+    template <relaxed_range Rng, relaxed_range Bins, typename BucketFn>
+    EVE_FORCEINLINE void operator()(Rng&& rng, Bins&& bins, BucketFn bucket_fn) const
+    {
+      if (rng.begin() == rng.end()) return;
+
+      auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
+      using N        = iterator_cardinal_t<decltype(processed.begin())>;
+
+      auto nbins = static_cast<std::uint32_t>(bins.end() - bins.begin());
+      if( nbins == 0 ) return;
+
+      std::size_t nsubs = detail::histogram_budget / (nbins + 1);
+      nsubs             = std::bit_floor(std::clamp(nsubs, std::size_t{1}, std::size_t{N::value}));
+      std::vector<std::uint32_t> subs(nsubs * (nbins + 1), 0);
+
+      auto iteration = algo::for_each_iteration(processed.traits(), processed.begin(), processed.end());
+      delegate<N, BucketFn> d{subs.data(), nbins, nsubs, bucket_fn};
+      iteration(d);
+
+      for( std::size_t k = 0; k != nsubs; ++k )
+      {
+        auto sub = subs.data() + k * (nbins + 1);
+        transform_to(views::zip(bins, sub), bins, detail::histogram_add{});
+      }
+    }
+
+    template <relaxed_range Rng, relaxed_range Bins>
+    EVE_FORCEINLINE void operator()(Rng&& rng, Bins&& bins) const
+    {
+      static_assert(std::integral<value_type_t<Rng>>,
+                    "eve::algo::histogram without a bucket function expects integral keys");
+      operator()(EVE_FWD(rng), EVE_FWD(bins), do_nothing{});
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var histogram
+  //!  @brief SIMD histogram
+  //!
+  //!  For every element `x` of the input, increments `bins[bucket_fn(x)]`.
+  //!  Counts are added to the values already in `bins`, buckets outside of `bins` are ignored.
+  //!
+  //!  There are no conflicts between the lanes: every lane increments its own private
+  //!  sub histogram (lanes share them when all of the sub histograms would not fit in L1),
+  //!  sub histograms are summed into `bins` at the end.
+  //!  This is most efficient for a small number of bins, for example 8 bits keys.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, relaxed_range Bins, typename BucketFn>
+  //!     void histogram(Rng&& rng, Bins&& bins, BucketFn bucket_fn);  // 1
+  //!
+  //!     template <relaxed_range Rng, relaxed_range Bins>
+  //!     void histogram(Rng&& rng, Bins&& bins);                      // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   1. `bucket_fn` takes a wide of elements and returns a wide of integral bucket indexes.
+  //!   2. Integral elements are their own bucket (count by key).
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range to process
+  //!    * `bins`: Relaxed range of counters, of any arithmetic type
+  //!    * `bucket_fn`: Maps elements to buckets
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/histogram.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto histogram = function_with_traits<histogram_>[default_simple_algo_traits];
+}
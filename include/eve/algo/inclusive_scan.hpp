@@ -11,19 +11,22 @@
 #include <eve/algo/array_utils.hpp>
 #include <eve/algo/common_forceinline_lambdas.hpp>
 #include <eve/algo/concepts.hpp>
+#include <eve/algo/detail/parallel.hpp>
 #include <eve/algo/for_each_iteration.hpp>
 #include <eve/algo/preprocess_range.hpp>
 #include <eve/algo/views/convert.hpp>
 #include <eve/algo/traits.hpp>
 
+#include <vector>
 
 namespace eve::algo
 {
   namespace detail
   {
 
-    template<typename LoadStore>
-    struct inclusive_scan_common
+    // Exclusive scans store the running sum before the element instead of after.
+    template<typename LoadStore, bool Exclusive = false>
+    struct scan_common
     {
       template<typename Op, typename Zero, typename Wide>
       struct delegate
@@ -42,9 +45,35 @@ namespace eve::algo
           auto xs = eve::load[ignore.else_(eve::as_value(zero, as<Wide> {}))](load_it);
           xs      = eve::scan(xs, op, zero);
           xs      = op(xs, running_sum);
+
+          if constexpr( Exclusive ) eve::store[ignore](eve::slide_right(running_sum, xs, eve::index<1>), store_it);
+          else                      eve::store[ignore](xs, store_it);
+
           running_sum = Wide(xs.back());
+          return false;
+        }
+
+        template<typename I, std::size_t size>
+        EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+        {
+          array_map(arr, call_single_step(this));
+          return false;
+        }
+      };
 
-          eve::store[ignore](xs, store_it);
+      // Only used by the parallel version to compute the carry of each subrange.
+      template<typename Op, typename Zero, typename Wide>
+      struct sum_delegate
+      {
+        Op   op;
+        Zero zero;
+        Wide sum;
+
+        sum_delegate(Op op, Zero zero) : op(op), zero(zero), sum(eve::as_value(zero, as<Wide> {})) {}
+
+        EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+        {
+          sum = op(sum, eve::load[ignore.else_(eve::as_value(zero, as<Wide> {}))](LoadStore::load_it(it)));
           return false;
         }
 
@@ -69,8 +98,31 @@ namespace eve::algo
 
         auto [op, zero] = op_zero;
 
-        delegate<Op, Zero, wide_t> d {op, zero, wide_init};
-        algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+        if constexpr( decltype(processed.traits())::contains(parallel) )
+        {
+          // Reduce each subrange, scan the sums and then scan each subrange with its carry.
+          detail::parallel_iteration iteration {processed.traits(), processed.begin(), processed.end()};
+          std::vector<wide_t>        carries(iteration.size(), wide_init);
+
+          iteration([&](std::size_t i, auto tr, auto f, auto l) {
+            if( i + 1 == carries.size() ) return;
+            sum_delegate<Op, Zero, wide_t> d {op, zero};
+            algo::for_each_iteration(tr, f, l)(d);
+            carries[i + 1] = wide_t(eve::reduce(d.sum, op));
+          });
+
+          for( std::size_t i = 1; i != carries.size(); ++i ) carries[i] = op(carries[i - 1], carries[i]);
+
+          iteration([&](std::size_t i, auto tr, auto f, auto l) {
+            delegate<Op, Zero, wide_t> d {op, zero, carries[i]};
+            algo::for_each_iteration(tr, f, l)(d);
+          });
+        }
+        else
+        {
+          delegate<Op, Zero, wide_t> d {op, zero, wide_init};
+          algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+        }
       }
     };
   }
@@ -81,7 +133,7 @@ namespace eve::algo
     template <relaxed_range Rng, typename Op, typename Zero, typename U>
     EVE_FORCEINLINE void operator()(Rng&& rng, std::pair<Op, Zero> op_zero, U init) const
     {
-      detail::inclusive_scan_common<inplace_load_store>{}(
+      detail::scan_common<inplace_load_store>{}(
         TraitsSupport::get_traits(), views::convert(EVE_FWD(rng), eve::as<U>{}), op_zero, init);
     }
 
@@ -100,7 +152,7 @@ namespace eve::algo
     template <zipped_range_pair R, typename Op, typename Zero, typename U>
     EVE_FORCEINLINE void operator()(R r, std::pair<Op, Zero> op_zero, U init) const
     {
-      detail::inclusive_scan_common<to_load_store>{}(
+      detail::scan_common<to_load_store>{}(
         TraitsSupport::get_traits(), r[force_type<U>], op_zero, init);
     }
 
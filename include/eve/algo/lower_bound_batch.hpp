@@ -0,0 +1,372 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/transform.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <bit>
+#include <cstddef>
+
+namespace eve::algo
+{
+  namespace detail
+  {
+    // Sorted ranges are searched through a raw pointer with eve::gather.
+    template <typename Traits, typename Rng>
+    EVE_FORCEINLINE auto haystack_data(Traits tr, Rng&& rng)
+    {
+      auto processed = preprocess_range(tr, EVE_FWD(rng));
+      auto f         = unalign(processed.begin());
+
+      static_assert(requires { f.ptr; }, "the haystack has to be a contiguous range");
+
+      return kumi::tuple{f.ptr, processed.end() - processed.begin()};
+    }
+
+    // Branchless binary search: the number of steps only depends on the size of the haystack,
+    // so all of the lanes advance together and only the base differs.
+    template <typename Idx, typename Ptr, typename Less, bool Upper>
+    struct batch_search
+    {
+      Ptr            haystack;
+      std::ptrdiff_t n;
+      Less           less;
+
+      EVE_FORCEINLINE auto go_right(auto candidate, auto x) const
+      {
+        if constexpr( Upper ) return !less(x, candidate);
+        else                  return less(candidate, x);
+      }
+
+      template <typename Wide> EVE_FORCEINLINE auto operator()(Wide x) const
+      {
+        using I = eve::wide<Idx, eve::cardinal_t<Wide>>;
+
+        I base(0);
+        if( n == 0 ) return base;
+
+        std::ptrdiff_t len = n;
+        while( len > 1 )
+        {
+          std::ptrdiff_t half = len / 2;
+          base = eve::if_else(go_right(eve::gather(haystack, base + Idx(half)), x), base + Idx(half), base);
+          len -= half;
+        }
+
+        return eve::if_else(go_right(eve::gather(haystack, base), x), base + Idx(1), base);
+      }
+    };
+
+    template <typename Idx, typename Ptr, typename Less>
+    struct eytzinger_search
+    {
+      Ptr            haystack;
+      std::ptrdiff_t n;
+      Less           less;
+
+      template <typename Wide> EVE_FORCEINLINE auto operator()(Wide x) const
+      {
+        using I = eve::wide<Idx, eve::cardinal_t<Wide>>;
+
+        // 1 based node indexes: the children of k are 2k and 2k + 1.
+        // Lanes stop going down once they leave the tree.
+        I k(1);
+        for( int depth = std::bit_width(static_cast<std::size_t>(n)); depth != 0; --depth )
+        {
+          auto inside = k <= Idx(n);
+          auto right  = less(eve::gather(haystack, eve::min(k, I(Idx(n))) - Idx(1)), x);
+          k           = eve::if_else(inside, k + k + eve::if_else(right, I(1), I(0)), k);
+        }
+
+        // Going back up to the last node where we went left, that is the lower bound.
+        using U = eve::as_integer_t<I, unsigned>;
+        auto u  = eve::bit_cast(k, eve::as<U>{});
+        k       = eve::bit_cast(u >> (eve::countr_one(u) + 1), eve::as<I>{});
+        return eve::if_else(eve::is_eqz(k), I(Idx(n)), k - Idx(1));
+      }
+    };
+
+    template <typename Out>
+    using search_index_t = value_type_t<std::remove_cvref_t<Out>>;
+
+    template <bool Upper, typename Traits, typename H, typename Needles, typename Out, typename Less>
+    EVE_FORCEINLINE void bound_batch(Traits tr, H&& haystack, Needles&& needles, Out&& out, Less less)
+    {
+      auto [ptr, n] = haystack_data(tr, EVE_FWD(haystack));
+      using idx_t   = search_index_t<Out>;
+      batch_search<idx_t, decltype(ptr), Less, Upper> s{ptr, n, less};
+      transform_to[tr](EVE_FWD(needles), EVE_FWD(out), s);
+    }
+  }
+
+  template <typename TraitsSupport>
+  struct lower_bound_batch_ : TraitsSupport
+  {
+    template <relaxed_range H, typename Needles, typename Out, typename Less>
+    requires zip_to_range<Needles, Out>
+    EVE_FORCEINLINE void operator()(H&& haystack, Needles&& needles, Out&& out, Less less) const
+    {
+      detail::bound_batch<false>(TraitsSupport::get_traits(), EVE_FWD(haystack), EVE_FWD(needles), EVE_FWD(out), less);
+    }
+
+    template <relaxed_range H, typename Needles, typename Out>
+    requires zip_to_range<Needles, Out>
+    EVE_FORCEINLINE void operator()(H&& haystack, Needles&& needles, Out&& out) const
+    {
+      operator()(EVE_FWD(haystack), EVE_FWD(needles), EVE_FWD(out), eve::is_less);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var lower_bound_batch
+  //!  @brief `std::lower_bound` for many needles at once
+  //!
+  //!  For every needle writes the position in the sorted `haystack` of the first element that
+  //!  is not less than the needle (the size of the haystack if there is none).
+  //!
+  //!  A wide of needles is searched at once with a branchless binary search: each step
+  //!  `eve::gather`s one candidate per lane. The number of steps only depends on the size of the
+  //!  haystack. With the default unrolling, several wides of needles are searched together,
+  //!  so the loop is bound by throughput instead of by the latency of memory accesses.
+  //!
+  //!  @note
+  //!         * The positions are computed in the value type of the output,
+  //!           which has to be an integral type able to hold the size of the haystack.
+  //!         * For big haystacks, eve::algo::eytzinger_lower_bound_batch is more cache friendly.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range H, typename Needles, typename Out, typename Less>
+  //!       requires zip_to_range<Needles, Out>
+  //!     void lower_bound_batch(H&& haystack, Needles&& needles, Out&& out, Less less = eve::is_less);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `haystack`: Contiguous range sorted with respect to `less`
+  //!    * `needles`: Relaxed range of values to search for
+  //!    * `out`: Relaxed range or iterator for the positions
+  //!    * `less`: Comparison taking two wides and returning a logical
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/lower_bound_batch.cpp}
+  //!
+  //!   @see upper_bound_batch
+  //! @}
+  //================================================================================================
+  inline constexpr auto lower_bound_batch = function_with_traits<lower_bound_batch_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct upper_bound_batch_ : TraitsSupport
+  {
+    template <relaxed_range H, typename Needles, typename Out, typename Less>
+    requires zip_to_range<Needles, Out>
+    EVE_FORCEINLINE void operator()(H&& haystack, Needles&& needles, Out&& out, Less less) const
+    {
+      detail::bound_batch<true>(TraitsSupport::get_traits(), EVE_FWD(haystack), EVE_FWD(needles), EVE_FWD(out), less);
+    }
+
+    template <relaxed_range H, typename Needles, typename Out>
+    requires zip_to_range<Needles, Out>
+    EVE_FORCEINLINE void operator()(H&& haystack, Needles&& needles, Out&& out) const
+    {
+      operator()(EVE_FWD(haystack), EVE_FWD(needles), EVE_FWD(out), eve::is_less);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var upper_bound_batch
+  //!  @brief `std::upper_bound` for many needles at once
+  //!
+  //!  Same as eve::algo::lower_bound_batch but finds the first element greater than the needle.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range H, typename Needles, typename Out, typename Less>
+  //!       requires zip_to_range<Needles, Out>
+  //!     void upper_bound_batch(H&& haystack, Needles&& needles, Out&& out, Less less = eve::is_less);
+  //!   }
+  //!   @endcode
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/lower_bound_batch.cpp}
+  //!
+  //!   @see lower_bound_batch
+  //! @}
+  //================================================================================================
+  inline constexpr auto upper_bound_batch = function_with_traits<upper_bound_batch_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct eytzinger_layout_ : TraitsSupport
+  {
+    template <typename I, typename O>
+    static void fill(I& sorted, O out, std::ptrdiff_t k, std::ptrdiff_t n)
+    {
+      if( k > n ) return;
+      fill(sorted, out, 2 * k, n);
+      eve::write(eve::read(sorted), out + (k - 1));
+      ++sorted;
+      fill(sorted, out, 2 * k + 1, n);
+    }
+
+    template <typename R1, typename R2>
+    requires zip_to_range<R1, R2>
+    EVE_FORCEINLINE void operator()(R1&& sorted, R2&& out) const
+    {
+      auto processed = preprocess_range(TraitsSupport::get_traits(), views::zip(EVE_FWD(sorted), EVE_FWD(out)));
+
+      auto           in = unalign(get<0>(processed.begin()));
+      std::ptrdiff_t n  = processed.end() - processed.begin();
+      fill(in, unalign(get<1>(processed.begin())), 1, n);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var eytzinger_layout
+  //!  @brief Copies a sorted range to the Eytzinger (breadth first binary tree) layout
+  //!
+  //!  The element at position `k` has its children at `2k + 1` and `2k + 2`.
+  //!  The top of the tree, that every search goes through, is at the beginning and stays in cache.
+  //!
+  //!  Any range can be laid out, so associated data can be moved to the same layout by zipping
+  //!  it with the keys.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <typename R1, typename R2>
+  //!       requires zip_to_range<R1, R2>
+  //!     void eytzinger_layout(R1&& sorted, R2&& out);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `sorted`: Relaxed range to lay out
+  //!    * `out`: Relaxed range or iterator of the destination, can not alias `sorted`
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/lower_bound_batch.cpp}
+  //!
+  //!   @see eytzinger_lower_bound_batch
+  //! @}
+  //================================================================================================
+  inline constexpr auto eytzinger_layout = function_with_traits<eytzinger_layout_>[no_traits];
+
+  template <typename TraitsSupport>
+  struct eytzinger_lower_bound_batch_ : TraitsSupport
+  {
+    template <relaxed_range H, typename Needles, typename Out, typename Less>
+    requires zip_to_range<Needles, Out>
+    EVE_FORCEINLINE void operator()(H&& haystack, Needles&& needles, Out&& out, Less less) const
+    {
+      auto tr       = TraitsSupport::get_traits();
+      auto [ptr, n] = detail::haystack_data(tr, EVE_FWD(haystack));
+      using idx_t   = detail::search_index_t<Out>;
+
+      detail::eytzinger_search<idx_t, decltype(ptr), Less> s{ptr, n, less};
+      transform_to[tr](EVE_FWD(needles), EVE_FWD(out), s);
+    }
+
+    template <relaxed_range H, typename Needles, typename Out>
+    requires zip_to_range<Needles, Out>
+    EVE_FORCEINLINE void operator()(H&& haystack, Needles&& needles, Out&& out) const
+    {
+      operator()(EVE_FWD(haystack), EVE_FWD(needles), EVE_FWD(out), eve::is_less);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var eytzinger_lower_bound_batch
+  //!  @brief eve::algo::lower_bound_batch for a haystack in the Eytzinger layout
+  //!
+  //!  For every needle writes the position in `haystack` (in the Eytzinger layout, as produced by
+  //!  eve::algo::eytzinger_layout) of the first element not less than the needle,
+  //!  or the size of the haystack if there is none.
+  //!
+  //!  Every step goes one level down the tree for all of the lanes. The first levels are shared
+  //!  by all of the searches and stay in cache, which makes it faster than the binary search on a
+  //!  sorted range for big haystacks.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range H, typename Needles, typename Out, typename Less>
+  //!       requires zip_to_range<Needles, Out>
+  //!     void eytzinger_lower_bound_batch(H&& haystack, Needles&& needles, Out&& out,
+  //!                                      Less less = eve::is_less);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `haystack`: Contiguous range in the Eytzinger layout
+  //!    * `needles`: Relaxed range of values to search for
+  //!    * `out`: Relaxed range or iterator for the positions
+  //!    * `less`: Comparison taking two wides and returning a logical
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/lower_bound_batch.cpp}
+  //!
+  //!   @see eytzinger_layout
+  //! @}
+  //================================================================================================
+  inline constexpr auto eytzinger_lower_bound_batch = function_with_traits<eytzinger_lower_bound_batch_>[default_simple_algo_traits];
+}
@@ -0,0 +1,308 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/array_utils.hpp>
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/copy.hpp>
+#include <eve/algo/detail/scratch_buffer.hpp>
+#include <eve/algo/for_each_iteration.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <array>
+
+namespace eve::algo
+{
+  template <typename TraitsSupport>
+  struct partition_copy_ : TraitsSupport
+  {
+    template <typename TrueI, typename FalseI, typename P>
+    struct delegate
+    {
+      delegate(TrueI out_true, FalseI out_false, P p) : out_true(out_true), out_false(out_false), p(p) {}
+
+      EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+      {
+        auto loaded = eve::load[ignore](it);
+        auto test   = p(loaded);
+
+        // We don't own the memory after the outputs, so the stores have to be exact.
+        out_true  = safe(compress_store)(convert_to<TrueI>(loaded),
+                                         eve::replace_ignored(test, ignore, false), out_true);
+        out_false = safe(compress_store)(convert_to<FalseI>(loaded),
+                                         eve::replace_ignored(!test, ignore, false), out_false);
+        return false;
+      }
+
+      template <typename I, std::size_t size>
+      EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+      {
+        array_map(arr, call_single_step(this));
+        return false;
+      }
+
+      template <typename Out> EVE_FORCEINLINE static auto convert_to(auto x)
+      {
+        return eve::convert(x, eve::as<value_type_t<Out>>{});
+      }
+
+      TrueI  out_true;
+      FalseI out_false;
+      P      p;
+    };
+
+    template <relaxed_range Rng, relaxed_iterator TrueI, relaxed_iterator FalseI, typename P>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, TrueI out_true, FalseI out_false, P p) const
+    {
+      if (rng.begin() == rng.end()) return kumi::tuple{out_true, out_false};
+
+      // zip is only used to agree on the cardinal, the outputs are advanced separately.
+      auto processed = preprocess_range(TraitsSupport::get_traits(), views::zip(EVE_FWD(rng), out_true, out_false));
+
+      auto f = processed.begin();
+      auto l = processed.end();
+
+      auto first_true  = unalign(get<1>(f));
+      auto first_false = unalign(get<2>(f));
+
+      auto iteration = algo::for_each_iteration(processed.traits(), get<0>(f), get<0>(l));
+      delegate<decltype(first_true), decltype(first_false), P> d{first_true, first_false, p};
+      iteration(d);
+
+      return kumi::tuple{out_true + (d.out_true - first_true), out_false + (d.out_false - first_false)};
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var partition_copy
+  //!  @brief SIMD version of std::partition_copy
+  //!
+  //!  Copies the elements that satisfy the predicate to `out_true` and the others to `out_false`
+  //!  in a single pass over the input. Both outputs preserve the relative order of the elements.
+  //!
+  //!  @note Only the elements written are touched in the outputs, so they only need
+  //!        to be big enough for what is written to them.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, relaxed_iterator TrueI, relaxed_iterator FalseI, typename P>
+  //!     kumi::tuple<TrueI, FalseI> partition_copy(Rng&& rng, TrueI out_true, FalseI out_false, P p);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range to process
+  //!    * `out_true`: Relaxed iterator, destination of the elements for which `p` is true
+  //!    * `out_false`: Relaxed iterator, destination of the elements for which `p` is false
+  //!    * `p`: Predicate taking a wide and returning a logical
+  //!
+  //!   **Return value**
+  //!
+  //!   The ends of the elements written to `out_true` and `out_false`.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/partition.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto partition_copy = function_with_traits<partition_copy_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct stable_partition_ : TraitsSupport
+  {
+    template <typename UnalignedI, typename BufferI, typename P>
+    struct delegate
+    {
+      delegate(UnalignedI out, BufferI rest, P p) : out(out), rest(rest), p(p) {}
+
+      EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+      {
+        auto loaded = eve::load[ignore](it);
+        auto test   = p(loaded);
+
+        // Same as remove_if: writing in place never overtakes the reading.
+        out  = unsafe(compress_store[ignore])(loaded, test, out);
+        // The buffer has an extra wide of space at the end.
+        rest = unsafe(compress_store)(loaded, eve::replace_ignored(!test, ignore, false), rest);
+        return false;
+      }
+
+      template <typename I, std::size_t size>
+      EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+      {
+        array_map(arr, call_single_step(this));
+        return false;
+      }
+
+      UnalignedI out;
+      BufferI    rest;
+      P          p;
+    };
+
+    template <relaxed_range Rng, typename P>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, P p) const
+    {
+      if (rng.begin() == rng.end()) return unalign(rng.begin());
+
+      auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
+
+      using I = unaligned_t<decltype(processed.begin())>;
+      using N = iterator_cardinal_t<I>;
+
+      std::ptrdiff_t n      = processed.end() - processed.begin();
+      auto           buffer = detail::make_scratch_buffer<value_type_t<I>>(n + N());
+      auto           rest   = unalign(preprocess_range(algo::traits(force_cardinal<N::value>), buffer).begin());
+
+      auto iteration = algo::for_each_iteration(processed.traits(), processed.begin(), processed.end());
+      delegate<I, decltype(rest), P> d{unalign(iteration.base), rest, p};
+      iteration(d);
+
+      if( d.rest != rest ) eve::algo::copy(as_range(rest, d.rest), d.out);
+      return unalign(rng.begin()) + (d.out - processed.begin());
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var stable_partition
+  //!  @brief SIMD version of std::stable_partition
+  //!
+  //!  Reorders the range so that the elements that satisfy the predicate come first, keeping
+  //!  the relative order in both groups.
+  //!  Elements that satisfy the predicate are compacted in place, the others are compacted
+  //!  to a temporary buffer and copied after them.
+  //!
+  //!  @note Uses a temporary buffer of the size of the range.
+  //!        If the input does not need to be preserved, eve::algo::partition_copy does the same
+  //!        without the extra copy.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, typename P>
+  //!     unaligned_t<iterator_t<Rng>> stable_partition(Rng&& rng, P p);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range to partition
+  //!    * `p`: Predicate taking a wide and returning a logical
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator to the first element of the second group.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/partition.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto stable_partition = function_with_traits<stable_partition_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct partition_point_ : TraitsSupport
+  {
+    template <relaxed_range Rng, typename P>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, P p) const
+    {
+      auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
+
+      using I = unaligned_t<decltype(processed.begin())>;
+      constexpr std::ptrdiff_t card = iterator_cardinal_v<I>;
+
+      I f = unalign(processed.begin());
+      I l = f + (processed.end() - processed.begin());
+
+      auto result = [&](I it) { return unalign(rng.begin()) + (it - processed.begin()); };
+
+      // Binary search where every probe tests a whole wide.
+      while( l - f > card )
+      {
+        I    mid         = f + (l - f - card) / 2;
+        auto first_false = eve::first_true(!p(eve::load(mid)));
+
+        if( !first_false )           f = mid + card;
+        else if( *first_false != 0 ) return result(mid + *first_false);
+        else                         l = mid;
+      }
+
+      auto ignore      = keep_first(l - f);
+      auto first_false = eve::first_true[ignore](!p(eve::load[ignore](f)));
+      return result(first_false ? f + *first_false : l);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var partition_point
+  //!  @brief SIMD version of std::partition_point
+  //!
+  //!  Binary search for the end of the first group of a partitioned range.
+  //!  Each probe loads and tests a whole wide, so the search stops as soon as a probe
+  //!  contains the boundary.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, typename P>
+  //!     unaligned_t<iterator_t<Rng>> partition_point(Rng&& rng, P p);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range, partitioned with respect to `p`
+  //!    * `p`: Predicate taking a wide and returning a logical
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator to the first element for which `p` is false, or the end of the range.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/partition.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto partition_point = function_with_traits<partition_point_>[no_traits];
+}
@@ -0,0 +1,327 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/assert.hpp>
+#include <eve/module/core.hpp>
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/copy.hpp>
+#include <eve/algo/detail/scratch_buffer.hpp>
+#include <eve/algo/histogram.hpp>
+#include <eve/algo/iota.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/transform.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace eve::algo
+{
+  namespace detail
+  {
+    // Maps keys to unsigned integers with the same order.
+    //   * unsigned: as is
+    //   * signed: flip the sign bit
+    //   * floating point: flip the sign bit of positive values, all the bits of negative ones
+    struct to_radix_bits
+    {
+      template <typename Wide> EVE_FORCEINLINE auto operator()(Wide x) const
+      {
+        using e_t = eve::element_type_t<Wide>;
+        using u_t = eve::as_integer_t<e_t, unsigned>;
+        using U   = eve::as_wide_t<u_t, eve::cardinal_t<Wide>>;
+
+        if constexpr( std::unsigned_integral<e_t> ) return x;
+        else if constexpr( std::signed_integral<e_t> )
+        {
+          return eve::bit_xor(eve::bit_cast(x, eve::as<U>{}), eve::signmask(eve::as<U>{}));
+        }
+        else
+        {
+          auto negative = eve::is_nez(eve::bit_cast(eve::bitofsign(x), eve::as<U>{}));
+          auto flip     = eve::if_else(negative, eve::allbits(eve::as<U>{}), eve::signmask(eve::as<U>{}));
+          return eve::bit_xor(eve::bit_cast(x, eve::as<U>{}), flip);
+        }
+      }
+    };
+
+    template <typename T>
+    struct from_radix_bits
+    {
+      template <typename Wide> EVE_FORCEINLINE auto operator()(Wide u) const
+      {
+        using W = eve::as_wide_t<T, eve::cardinal_t<Wide>>;
+
+        if constexpr( std::unsigned_integral<T> ) return u;
+        else if constexpr( std::signed_integral<T> )
+        {
+          return eve::bit_cast(eve::bit_xor(u, eve::signmask(eve::as<Wide>{})), eve::as<W>{});
+        }
+        else
+        {
+          // The sign bit is set for values that were positive.
+          auto positive = eve::is_nez(eve::bit_and(u, eve::signmask(eve::as<Wide>{})));
+          auto flip     = eve::if_else(positive, eve::signmask(eve::as<Wide>{}), eve::allbits(eve::as<Wide>{}));
+          return eve::bit_cast(eve::bit_xor(u, flip), eve::as<W>{});
+        }
+      }
+    };
+
+    template <typename U>
+    struct radix_digit
+    {
+      int shift;
+
+      EVE_FORCEINLINE auto operator()(auto u) const { return (u >> shift) & U{0xFF}; }
+    };
+
+    struct radix_key_bits
+    {
+      EVE_FORCEINLINE auto operator()(auto x) const { return to_radix_bits{}(get<0>(x)); }
+    };
+
+    // LSD radix sort of `keys` by bytes, the ranks (if not null) are moved with them.
+    // Returns the buffer that holds the result: `keys` or `keys_buffer`.
+    template <typename Traits, typename U, typename Rank>
+    std::vector<U>& radix_sort_bits(Traits tr,
+                                    std::vector<U>& keys, std::vector<U>& keys_buffer,
+                                    std::vector<Rank>* ranks, std::vector<Rank>* ranks_buffer)
+    {
+      constexpr int digits = sizeof(U);
+      std::size_t   n      = keys.size();
+
+      // All of the histograms are computed upfront, so that the passes where all of the
+      // elements have the same digit can be skipped.
+      std::array<std::array<std::size_t, 256>, digits> counts = {};
+      for( int d = 0; d != digits; ++d )
+      {
+        histogram[tr](keys, counts[d], radix_digit<U>{8 * d});
+      }
+
+      std::vector<U>*    src   = &keys;
+      std::vector<U>*    dst   = &keys_buffer;
+      std::vector<Rank>* r_src = ranks;
+      std::vector<Rank>* r_dst = ranks_buffer;
+
+      for( int d = 0; d != digits; ++d )
+      {
+        int shift = 8 * d;
+        if( counts[d][((*src)[0] >> shift) & 0xFF] == n ) continue;
+
+        std::array<std::size_t, 256> offsets;
+        std::size_t                  sum = 0;
+        for( int b = 0; b != 256; ++b )
+        {
+          offsets[b] = sum;
+          sum += counts[d][b];
+        }
+
+        U* s = src->data();
+        U* o = dst->data();
+
+        if( ranks )
+        {
+          Rank* rs = r_src->data();
+          Rank* ro = r_dst->data();
+          for( std::size_t i = 0; i != n; ++i )
+          {
+            std::size_t pos = offsets[(s[i] >> shift) & 0xFF]++;
+            o[pos]          = s[i];
+            ro[pos]         = rs[i];
+          }
+          std::swap(r_src, r_dst);
+        }
+        else
+        {
+          for( std::size_t i = 0; i != n; ++i ) o[offsets[(s[i] >> shift) & 0xFF]++] = s[i];
+        }
+
+        std::swap(src, dst);
+      }
+
+      if( ranks && r_src != ranks ) std::swap(*ranks, *ranks_buffer);
+      return *src;
+    }
+  }
+
+  template <typename TraitsSupport>
+  struct radix_sort_ : TraitsSupport
+  {
+    template <relaxed_range Rng> EVE_FORCEINLINE void operator()(Rng&& rng) const
+    {
+      using T = value_type_t<Rng>;
+      using U = eve::as_integer_t<T, unsigned>;
+
+      static_assert(eve::plain_scalar_value<T>,
+                    "eve::algo::radix_sort only supports arithmetic types, use radix_sort_by_key for tuples");
+
+      std::size_t n = rng.end() - rng.begin();
+      if( n < 2 ) return;
+
+      auto tr = TraitsSupport::get_traits();
+
+      std::vector<U> keys(n), keys_buffer(n);
+      transform_to[tr](rng, keys, detail::to_radix_bits{});
+
+      auto& sorted = detail::radix_sort_bits<decltype(tr), U, std::uint32_t>(tr, keys, keys_buffer, nullptr, nullptr);
+
+      transform_to[tr](sorted, rng, detail::from_radix_bits<T>{});
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var radix_sort
+  //!
+  //!  @brief LSD radix sort of integers or floating point values in ascending order
+  //!
+  //!  The keys are mapped to unsigned integers with the same order (flipping the sign bit
+  //!  of signed integers and of positive floating points, all the bits of negative ones),
+  //!  then sorted one byte at a time, starting from the least significant one.
+  //!  Conversions and the histograms of all the bytes are computed with SIMD algorithms,
+  //!  passes in which all of the keys have the same byte are skipped.
+  //!
+  //!  For big ranges this is much faster than eve::algo::sort.
+  //!
+  //!  @note
+  //!         * Uses two temporary buffers of the size of the range.
+  //!         * `-0.0` is sorted before `0.0`, NaNs are sorted at the ends depending on their sign.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <eve::algo::relaxed_range Rng>
+  //!     void radix_sort(Rng&& rng);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range of arithmetic values to sort
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/radix_sort.cpp}
+  //!
+  //!   @see sort
+  //!   @see radix_sort_by_key
+  //! @}
+  //================================================================================================
+  inline constexpr auto radix_sort = function_with_traits<radix_sort_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct radix_sort_by_key_ : TraitsSupport
+  {
+    template <relaxed_range Rng> EVE_FORCEINLINE void operator()(Rng&& rng) const
+    {
+      using T = value_type_t<Rng>;
+
+      static_assert(kumi::product_type<T>,
+                    "eve::algo::radix_sort_by_key expects a range of tuples, sorted by their first component");
+
+      using K = std::remove_cvref_t<decltype(get<0>(std::declval<T>()))>;
+      using U = eve::as_integer_t<K, unsigned>;
+
+      std::size_t n = rng.end() - rng.begin();
+      if( n < 2 ) return;
+
+      EVE_ASSERT(n <= std::numeric_limits<std::uint32_t>::max(), "radix_sort_by_key ranks are 32 bits");
+
+      auto tr = TraitsSupport::get_traits();
+
+      // Keys are sorted with their rank, tuples are then moved to their place in one go.
+      std::vector<U>             keys(n), keys_buffer(n);
+      std::vector<std::uint32_t> ranks(n), ranks_buffer(n);
+
+      transform_to[tr](rng, keys, detail::radix_key_bits{});
+      iota[tr](ranks, std::uint32_t{0});
+
+      detail::radix_sort_bits(tr, keys, keys_buffer, &ranks, &ranks_buffer);
+
+      auto processed = preprocess_range(tr, EVE_FWD(rng));
+      auto f         = unalign(processed.begin());
+
+      using N     = iterator_cardinal_t<decltype(f)>;
+      auto buffer = detail::make_scratch_buffer<T>(n);
+      auto b      = unalign(preprocess_range(algo::traits(force_cardinal<N::value>), buffer).begin());
+      eve::algo::copy(as_range(f, f + n), b);
+
+      for( std::size_t i = 0; i != n; ++i ) eve::write(eve::read(b + ranks[i]), f + i);
+    }
+
+    template<relaxed_range Keys, typename Values>
+    requires zip_to_range<Keys, Values>
+    EVE_FORCEINLINE void operator()(Keys&& keys, Values&& values) const
+    {
+      operator()(views::zip(EVE_FWD(keys), EVE_FWD(values)));
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var radix_sort_by_key
+  //!
+  //!  @brief Stable LSD radix sort of tuples by their first component
+  //!
+  //!  Same as eve::algo::radix_sort on the first component of the tuples, the other components
+  //!  are moved with their key. Unlike eve::algo::sort_by_key, the sort is stable.
+  //!
+  //!  @note Uses temporary buffers of the size of the range: two for the keys, two for
+  //!        32 bits ranks and one copy of the tuples.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <eve::algo::relaxed_range Rng>
+  //!     void radix_sort_by_key(Rng&& rng);                           // 1
+  //!
+  //!     template <eve::algo::relaxed_range Keys, typename Values>
+  //!     void radix_sort_by_key(Keys&& keys, Values&& values);        // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   1. Sorts a range of tuples, for example a `soa_vector`.
+  //!   2. Same as `radix_sort_by_key(eve::views::zip(keys, values))`.
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed range of tuples, the first component being an arithmetic key
+  //!    * `keys`, `values`: Relaxed ranges or iterators to zip together
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/radix_sort.cpp}
+  //!
+  //!   @see sort_by_key
+  //! @}
+  //================================================================================================
+  inline constexpr auto radix_sort_by_key = function_with_traits<radix_sort_by_key_>[default_simple_algo_traits];
+}
@@ -9,6 +9,7 @@
 
 #include <eve/module/core.hpp>
 #include <eve/algo/array_utils.hpp>
+#include <eve/algo/detail/parallel.hpp>
 #include <eve/algo/for_each_iteration.hpp>
 #include <eve/algo/preprocess_range.hpp>
 #include <eve/algo/views/convert.hpp>
@@ -17,6 +18,7 @@
 #include <eve/traits.hpp>
 
 #include <utility>
+#include <vector>
 
 namespace eve::algo
 {
@@ -54,10 +56,9 @@ namespace eve::algo
         return false;
       }
 
-      EVE_FORCEINLINE auto finish() {
-        auto sum = array_reduce(sums, op);
-        return eve::reduce(sum, op);
-      }
+      EVE_FORCEINLINE Wide partial() { return array_reduce(sums, op); }
+
+      EVE_FORCEINLINE auto finish() { return eve::reduce(partial(), op); }
     };
 
     template <eve::algo::relaxed_range Rng, typename Op, typename Zero, typename U>
@@ -74,10 +75,30 @@ namespace eve::algo
       wide_t init_as_wide = eve::as_value(op_zero.second, as<wide_t>{});
       init_as_wide.set(0, init);
 
-      delegate<Op, Zero, wide_t> d{op_zero.first, op_zero.second, init_as_wide};
+      if constexpr( decltype(processed.traits())::contains(parallel) )
+      {
+        // Every subrange computes a wide of partial sums, the init only goes to the first one.
+        detail::parallel_iteration iteration{processed.traits(), processed.begin(), processed.end()};
+        std::vector<wide_t> partials(iteration.size());
+
+        iteration([&](std::size_t i, auto tr, auto f, auto l) {
+          wide_t sub_init = i ? eve::as_value(op_zero.second, as<wide_t>{}) : init_as_wide;
+          delegate<Op, Zero, wide_t> d{op_zero.first, op_zero.second, sub_init};
+          algo::for_each_iteration(tr, f, l)(d);
+          partials[i] = d.partial();
+        });
+
+        wide_t sum = partials[0];
+        for( std::size_t i = 1; i != partials.size(); ++i ) sum = op_zero.first(sum, partials[i]);
+        return eve::reduce(sum, op_zero.first);
+      }
+      else
+      {
+        delegate<Op, Zero, wide_t> d{op_zero.first, op_zero.second, init_as_wide};
 
-      algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
-      return d.finish();
+        algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+        return d.finish();
+      }
     }
 
     template <eve::algo::relaxed_range Rng, typename U>
@@ -11,12 +11,15 @@
 #include <eve/algo/array_utils.hpp>
 #include <eve/algo/concepts.hpp>
 #include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/copy.hpp>
+#include <eve/algo/detail/parallel.hpp>
 #include <eve/algo/for_each_iteration.hpp>
 #include <eve/algo/preprocess_range.hpp>
 #include <eve/algo/traits.hpp>
 
 
 #include <array>
+#include <vector>
 
 namespace eve::algo
 {
@@ -54,6 +57,31 @@ namespace eve::algo
 
       auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
 
+      if constexpr( decltype(processed.traits())::contains(parallel) )
+      {
+        // Each subrange is compacted in place, then the kept elements are moved
+        // next to each other.
+        using UI = unaligned_t<decltype(processed.begin())>;
+
+        detail::parallel_iteration iteration{processed.traits(), processed.begin(), processed.end()};
+        std::vector<UI> ends(iteration.size());
+
+        iteration([&](std::size_t i, auto tr, auto f, auto l) {
+          auto sub_iteration = algo::for_each_iteration(tr, f, l);
+          delegate<UI, P> d{unalign(sub_iteration.base), p};
+          sub_iteration(d);
+          ends[i] = d.out;
+        });
+
+        UI out = ends[0];
+        for( std::size_t i = 1; i != ends.size(); ++i )
+        {
+          if( out != iteration.begin(i) ) copy(as_range(iteration.begin(i), ends[i]), out);
+          out += ends[i] - iteration.begin(i);
+        }
+        return unalign(rng.begin()) + (out - processed.begin());
+      }
+
       auto iteration = algo::for_each_iteration(processed.traits(), processed.begin(), processed.end());
       auto out = iteration.base;
       delegate<unaligned_t<decltype(out)>, P> d{unalign(out), p};
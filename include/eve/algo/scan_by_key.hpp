@@ -0,0 +1,324 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/array_utils.hpp>
+#include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/for_each_iteration.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <array>
+#include <utility>
+
+namespace eve::algo
+{
+  namespace detail
+  {
+    // Scan operation on (starts a segment, value) pairs: a value does not accumulate what is
+    // before the start of its segment. Called as op(later, earlier), same as eve::scan.
+    template<typename Op>
+    struct segmented_op
+    {
+      Op op;
+
+      EVE_FORCEINLINE auto operator()(auto later, auto earlier) const
+      {
+        auto [later_start, later_value]     = later;
+        auto [earlier_start, earlier_value] = earlier;
+        return eve::zip(later_start | earlier_start,
+                        eve::if_else(eve::is_nez(later_start), later_value, op(later_value, earlier_value)));
+      }
+    };
+
+    // A segment starts where the key differs from the previous one.
+    template<typename Wide>
+    struct key_starts
+    {
+      Wide prev;
+
+      EVE_FORCEINLINE auto operator()(Wide keys, eve::relative_conditional_expr auto ignore)
+      {
+        keys        = eve::replace_ignored(keys, ignore, prev);
+        auto starts = keys != eve::slide_right(prev, keys, eve::index<1>);
+        prev        = keys;
+        return starts;
+      }
+    };
+
+    // A segment starts where the flag is not zero.
+    struct flag_starts
+    {
+      EVE_FORCEINLINE auto operator()(auto flags, eve::relative_conditional_expr auto ignore) const
+      {
+        return eve::replace_ignored(eve::is_nez(flags), ignore, false);
+      }
+    };
+
+    template<std::size_t Out, typename Starts, typename Op, typename Zero, typename Wide>
+    struct segmented_scan_delegate
+    {
+      Starts starts;
+      Op     op;
+      Zero   zero;
+      Wide   running_sum;
+
+      EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+      {
+        using u_t    = eve::element_type_t<Wide>;
+        using flag_t = eve::as_integer_t<u_t, unsigned>;
+        using flags  = eve::wide<flag_t, eve::cardinal_t<Wide>>;
+
+        auto loaded = eve::load[ignore](it);
+
+        auto is_start = eve::convert(starts(get<0>(loaded), ignore), eve::as<eve::logical<flag_t>> {});
+        Wide xs       = eve::convert(get<1>(loaded), eve::as<u_t> {});
+        xs            = eve::replace_ignored(xs, ignore, eve::as_value(zero, eve::as<Wide> {}));
+
+        auto [started, sums] = eve::scan(eve::zip(eve::if_else(is_start, flags(1), flags(0)), xs),
+                                         segmented_op<Op> {op},
+                                         kumi::tuple {flag_t {0}, eve::as_value(zero, eve::as<u_t> {})});
+
+        // Lanes before the first start continue the segment of the previous wide.
+        sums        = eve::if_else(eve::is_nez(started), sums, op(sums, running_sum));
+        running_sum = Wide(sums.back());
+
+        eve::store[ignore](sums, get<Out>(it));
+        return false;
+      }
+
+      template<typename I, std::size_t size>
+      EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+      {
+        array_map(arr, call_single_step(this));
+        return false;
+      }
+    };
+
+    // `rng` zips segments (keys or flags), values and, for Out == 2, the destination.
+    template<bool ByKey, std::size_t Out, typename Traits, typename Rng, typename Op, typename Zero>
+    EVE_FORCEINLINE void segmented_scan(Traits tr, Rng&& rng, std::pair<Op, Zero> op_zero)
+    {
+      if( rng.begin() == rng.end() ) return;
+
+      auto processed = preprocess_range(tr, EVE_FWD(rng));
+      auto f         = unalign(processed.begin());
+
+      using u_t  = value_type_t<std::remove_cvref_t<decltype(get<Out>(f))>>;
+      using N    = iterator_cardinal_t<decltype(f)>;
+      using Wide = eve::wide<u_t, N>;
+
+      auto [op, zero] = op_zero;
+      Wide init       = eve::as_value(zero, eve::as<Wide> {});
+
+      auto starts = [&]
+      {
+        using keys_t = wide_value_type_t<std::remove_cvref_t<decltype(get<0>(f))>>;
+        if constexpr( ByKey ) return key_starts<keys_t> {keys_t(eve::read(get<0>(f)))};
+        else                  return flag_starts {};
+      }();
+
+      segmented_scan_delegate<Out, decltype(starts), Op, Zero, Wide> d {starts, op, zero, init};
+      algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+    }
+  }
+
+  template <typename TraitsSupport>
+  struct inclusive_scan_by_key_inplace_ : TraitsSupport
+  {
+    template <typename Keys, typename Values, typename Op, typename Zero>
+      requires zip_to_range<Keys, Values>
+    EVE_FORCEINLINE void operator()(Keys&& keys, Values&& values, std::pair<Op, Zero> op_zero) const
+    {
+      detail::segmented_scan<true, 1>(TraitsSupport::get_traits(), views::zip(EVE_FWD(keys), EVE_FWD(values)), op_zero);
+    }
+
+    template <typename Keys, typename Values>
+      requires zip_to_range<Keys, Values>
+    EVE_FORCEINLINE void operator()(Keys&& keys, Values&& values) const
+    {
+      operator()(EVE_FWD(keys), EVE_FWD(values), std::pair{eve::plus, eve::zero});
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var inclusive_scan_by_key_inplace
+  //!  @brief Inclusive scan of the values, restarting whenever the key changes
+  //!
+  //!  Every group of consecutive equal keys is a segment: the value `i` becomes the combination of
+  //!  the values from the start of its segment up to `i` (a group-by aggregation on sorted keys).
+  //!
+  //!  Segment starts are found by comparing the keys with themselves slid by one lane, then
+  //!  the in register eve::scan is done on (start, value) pairs with an operation that does not
+  //!  accumulate across a start.
+  //!
+  //!  Any associative operation can be used, with its identity as the `zero`:
+  //!  `{eve::plus, eve::zero}`, `{eve::max, eve::valmin}`, `{eve::min, eve::valmax}`,
+  //!  `{eve::bit_or, eve::zero}`...
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <typename Keys, typename Values, typename Op, typename Zero>
+  //!       requires zip_to_range<Keys, Values>
+  //!     void inclusive_scan_by_key_inplace(Keys&& keys, Values&& values, std::pair<Op, Zero> op_zero);
+  //!
+  //!     template <typename Keys, typename Values>
+  //!       requires zip_to_range<Keys, Values>
+  //!     void inclusive_scan_by_key_inplace(Keys&& keys, Values&& values);  // {eve::plus, eve::zero}
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `keys`: Relaxed range or iterator of the keys
+  //!    * `values`: Relaxed range or iterator of the values to scan
+  //!    * `op_zero`: Associative operation and its identity
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/scan_by_key.cpp}
+  //!
+  //!   @see inclusive_scan_by_key_to
+  //!   @see segmented_inclusive_scan_inplace
+  //! @}
+  //================================================================================================
+  inline constexpr auto inclusive_scan_by_key_inplace = function_with_traits<inclusive_scan_by_key_inplace_>[no_traits];
+
+  template <typename TraitsSupport>
+  struct inclusive_scan_by_key_to_ : TraitsSupport
+  {
+    template <typename Keys, typename Values, typename Out, typename Op, typename Zero>
+    EVE_FORCEINLINE void operator()(Keys&& keys, Values&& values, Out&& out, std::pair<Op, Zero> op_zero) const
+    {
+      detail::segmented_scan<true, 2>(TraitsSupport::get_traits(),
+                                      views::zip(EVE_FWD(keys), EVE_FWD(values), EVE_FWD(out)),
+                                      op_zero);
+    }
+
+    template <typename Keys, typename Values, typename Out>
+    EVE_FORCEINLINE void operator()(Keys&& keys, Values&& values, Out&& out) const
+    {
+      operator()(EVE_FWD(keys), EVE_FWD(values), EVE_FWD(out), std::pair{eve::plus, eve::zero});
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var inclusive_scan_by_key_to
+  //!  @brief Same as eve::algo::inclusive_scan_by_key_inplace, writing the result to `out`
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <typename Keys, typename Values, typename Out, typename Op, typename Zero>
+  //!     void inclusive_scan_by_key_to(Keys&& keys, Values&& values, Out&& out, std::pair<Op, Zero> op_zero);
+  //!
+  //!     template <typename Keys, typename Values, typename Out>
+  //!     void inclusive_scan_by_key_to(Keys&& keys, Values&& values, Out&& out);  // {eve::plus, eve::zero}
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `keys`, `values`, `out`: Relaxed ranges or iterators zipping together to a range.
+  //!      The values are converted to the type of `out`.
+  //!    * `op_zero`: Associative operation and its identity
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/scan_by_key.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto inclusive_scan_by_key_to = function_with_traits<inclusive_scan_by_key_to_>[no_traits];
+
+  template <typename TraitsSupport>
+  struct segmented_inclusive_scan_inplace_ : TraitsSupport
+  {
+    template <typename Flags, typename Values, typename Op, typename Zero>
+      requires zip_to_range<Flags, Values>
+    EVE_FORCEINLINE void operator()(Flags&& flags, Values&& values, std::pair<Op, Zero> op_zero) const
+    {
+      detail::segmented_scan<false, 1>(TraitsSupport::get_traits(), views::zip(EVE_FWD(flags), EVE_FWD(values)), op_zero);
+    }
+
+    template <typename Flags, typename Values>
+      requires zip_to_range<Flags, Values>
+    EVE_FORCEINLINE void operator()(Flags&& flags, Values&& values) const
+    {
+      operator()(EVE_FWD(flags), EVE_FWD(values), std::pair{eve::plus, eve::zero});
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var segmented_inclusive_scan_inplace
+  //!  @brief Inclusive scan of the values, restarting at every non zero flag
+  //!
+  //!  Same as eve::algo::inclusive_scan_by_key_inplace with the segments starts given explicitly:
+  //!  a value with a non zero flag does not accumulate the values before it.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <typename Flags, typename Values, typename Op, typename Zero>
+  //!       requires zip_to_range<Flags, Values>
+  //!     void segmented_inclusive_scan_inplace(Flags&& flags, Values&& values, std::pair<Op, Zero> op_zero);
+  //!
+  //!     template <typename Flags, typename Values>
+  //!       requires zip_to_range<Flags, Values>
+  //!     void segmented_inclusive_scan_inplace(Flags&& flags, Values&& values);  // {eve::plus, eve::zero}
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `flags`: Relaxed range or iterator of arithmetic values, non zero for segment starts
+  //!    * `values`: Relaxed range or iterator of the values to scan
+  //!    * `op_zero`: Associative operation and its identity
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/scan_by_key.cpp}
+  //!
+  //!   @see inclusive_scan_by_key_inplace
+  //! @}
+  //================================================================================================
+  inline constexpr auto segmented_inclusive_scan_inplace = function_with_traits<segmented_inclusive_scan_inplace_>[no_traits];
+}
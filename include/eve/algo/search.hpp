@@ -0,0 +1,170 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/equal.hpp>
+#include <eve/algo/find.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/views/zip.hpp>
+#include <eve/module/core.hpp>
+
+#include <array>
+#include <utility>
+
+namespace eve::algo
+{
+namespace detail
+{
+  // Lane i of component k is the element at position i + offsets[k] of the haystack.
+  // The candidate has to match the needle at all of those offsets.
+  template<typename T, std::size_t K> struct search_filter
+  {
+    std::array<T, K> values;
+
+    EVE_FORCEINLINE auto operator()(auto x) const
+    {
+      return [&]<std::size_t... I>(std::index_sequence<I...>)
+      { return ((get<I>(x) == values[I]) && ...); }(std::make_index_sequence<K> {});
+    }
+  };
+
+  // Finds the first position in [0, count) where the haystack matches the needle at all the
+  // offsets, count if there is none.
+  template<typename Traits, typename I, typename T, std::size_t K>
+  EVE_FORCEINLINE std::ptrdiff_t search_candidate(Traits tr,
+                                                  I h, std::ptrdiff_t count,
+                                                  std::array<std::ptrdiff_t, K> offsets,
+                                                  search_filter<T, K> filter)
+  {
+    auto shifted = [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+      return views::zip(as_range(h + offsets[0], h + offsets[0] + count), (h + offsets[Is + 1])...);
+    }(std::make_index_sequence<K - 1> {});
+
+    return find_if[tr](shifted, filter) - shifted.begin();
+  }
+
+  template<std::size_t K, typename Traits, typename I, typename N>
+  EVE_FORCEINLINE std::ptrdiff_t search_exact(Traits tr, I h, std::ptrdiff_t n, N needle)
+  {
+    using T = value_type_t<I>;
+
+    std::array<std::ptrdiff_t, K> offsets;
+    search_filter<T, K>           filter;
+    for( std::size_t k = 0; k != K; ++k )
+    {
+      offsets[k]       = k;
+      filter.values[k] = static_cast<T>(eve::read(needle + k));
+    }
+
+    std::ptrdiff_t count = n - K + 1;
+    std::ptrdiff_t pos   = search_candidate(tr, h, count, offsets, filter);
+    return pos == count ? n : pos;
+  }
+}
+
+template<typename TraitsSupport> struct search_ : TraitsSupport
+{
+  template<relaxed_range Haystack, relaxed_range Needle>
+  EVE_FORCEINLINE auto operator()(Haystack&& haystack, Needle&& needle) const
+    -> unaligned_iterator_t<Haystack>
+  {
+    using T = value_type_t<Haystack>;
+
+    auto res = unalign(haystack.begin());
+
+    std::ptrdiff_t n = haystack.end() - haystack.begin();
+    std::ptrdiff_t m = needle.end() - needle.begin();
+    if( m == 0 ) return res;
+    if( m > n ) return res + n;
+
+    auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(haystack));
+    auto tr        = processed.traits();
+    auto h         = unalign(processed.begin());
+    auto s         = unalign(preprocess_range(tr, EVE_FWD(needle)).begin());
+
+    // Short needles are compared entirely in SIMD.
+    switch( m )
+    {
+      case 1: return res + detail::search_exact<1>(tr, h, n, s);
+      case 2: return res + detail::search_exact<2>(tr, h, n, s);
+      case 3: return res + detail::search_exact<3>(tr, h, n, s);
+      case 4: return res + detail::search_exact<4>(tr, h, n, s);
+    }
+
+    // Otherwise only the first and the last elements are compared in SIMD: for real data
+    // both matching at the right distance is rare, the rest of the candidates is verified
+    // with eve::algo::equal.
+    detail::search_filter<T, 2> filter {{static_cast<T>(eve::read(s)), static_cast<T>(eve::read(s + (m - 1)))}};
+    std::array<std::ptrdiff_t, 2> offsets {0, m - 1};
+
+    std::ptrdiff_t count = n - m + 1;
+    std::ptrdiff_t pos   = 0;
+    while( pos != count )
+    {
+      pos += detail::search_candidate(tr, h + pos, count - pos, offsets, filter);
+      if( pos == count ) break;
+
+      if( algo::equal[tr](as_range(h + pos + 1, h + pos + m - 1), s + 1) ) return res + pos;
+      ++pos;
+    }
+    return res + n;
+  }
+};
+
+//================================================================================================
+//! @addtogroup algos
+//! @{
+//!  @var search
+//!
+//!  @brief SIMD version of std::search (memmem)
+//!
+//!  Finds the first occurrence of `needle` in `haystack`.
+//!
+//!  Every position of the haystack is tested at once for the first and the last element of the
+//!  needle (two shifted loads compared to broadcasts of those elements), using eve::algo::find_if.
+//!  Candidates are then verified with eve::algo::equal, and the search resumes after a false
+//!  positive. Needles of up to 4 elements are compared in full in SIMD, without verification.
+//!
+//!   **Alternative Header**
+//!
+//!   @code
+//!   #include <eve/algo.hpp>
+//!   @endcode
+//!
+//!   @groupheader{Callable Signatures}
+//!
+//!   @code
+//!   namespace eve::algo
+//!   {
+//!     template <eve::algo::relaxed_range Haystack, eve::algo::relaxed_range Needle>
+//!     auto search(Haystack&& haystack, Needle&& needle) -> unaligned_iterator_t<Haystack>;
+//!   }
+//!   @endcode
+//!
+//!   **Parameters**
+//!
+//!    * `haystack`: Relaxed input range to search in
+//!    * `needle`: Relaxed range of the elements to search for
+//!
+//!   **Return value**
+//!
+//!   Iterator on the first element of the first occurrence, past the end if there is none
+//!   (the beginning of the haystack for an empty needle, same as std).
+//!
+//!   @groupheader{Example}
+//!
+//!   @godbolt{doc/algo/search.cpp}
+//!
+//! @}
+//================================================================================================
+inline constexpr auto search = function_with_traits<search_>[default_simple_algo_traits];
+}
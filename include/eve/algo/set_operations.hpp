@@ -0,0 +1,433 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/sort.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace eve::algo
+{
+  namespace detail
+  {
+    // Both inputs are read with the cardinal of the first one (the output is zipped with it
+    // only to agree on that cardinal, it is advanced separately).
+    template <typename Traits, typename R1, typename R2, typename O>
+    EVE_FORCEINLINE auto set_operation_setup(Traits tr, R1&& r1, R2&& r2, O out)
+    {
+      static_assert(std::same_as<value_type_t<R1>, value_type_t<R2>>,
+                    "eve::algo set operations expect both ranges to have the same value type");
+
+      auto processed1 = preprocess_range(tr, views::zip(EVE_FWD(r1), out));
+      auto a          = unalign(get<0>(processed1.begin()));
+      auto o          = unalign(get<1>(processed1.begin()));
+
+      using N         = iterator_cardinal_t<decltype(a)>;
+      auto processed2 = preprocess_range(algo::traits(force_cardinal<N::value>), EVE_FWD(r2));
+      auto b          = unalign(processed2.begin());
+
+      return kumi::tuple{a, processed1.end() - processed1.begin(), b, processed2.end() - processed2.begin(), o};
+    }
+
+    // Lanes of `a` equal to any lane of `b`: `a` is compared with every lane of `b` broadcast.
+    template <typename Wide>
+    EVE_FORCEINLINE auto match_any(Wide a, Wide b)
+    {
+      return [&]<std::size_t... K>(std::index_sequence<K...>)
+      {
+        return ((a == eve::broadcast(b, eve::index<K>)) || ...);
+      }(std::make_index_sequence<Wide::size()>{});
+    }
+
+    template <typename O, typename Wide, typename Mask>
+    EVE_FORCEINLINE O set_store(Wide x, Mask mask, O out)
+    {
+      // We don't own the memory after the output, so the store has to be exact.
+      return safe(compress_store)(eve::convert(x, eve::as<value_type_t<O>>{}), mask, out);
+    }
+
+    template <typename O, typename T>
+    EVE_FORCEINLINE O set_write(T x, O out)
+    {
+      eve::write(static_cast<value_type_t<O>>(x), out);
+      return out + 1;
+    }
+
+    // Scalar merge of what is left after the blocks.
+    // Keeps elements of `a` found in `b` (Intersect) or not found in `b` (!Intersect).
+    template <bool Intersect, typename I, typename O>
+    O set_filter_tail(I a, std::ptrdiff_t i, std::ptrdiff_t na, I b, std::ptrdiff_t j, std::ptrdiff_t nb, O o)
+    {
+      while( i != na && j != nb )
+      {
+        auto x = eve::read(a + i);
+        auto y = eve::read(b + j);
+        if( x < y )
+        {
+          if constexpr( !Intersect ) o = set_write(x, o);
+          ++i;
+        }
+        else if( y < x ) ++j;
+        else
+        {
+          if constexpr( Intersect ) o = set_write(x, o);
+          ++i;
+          ++j;
+        }
+      }
+
+      if constexpr( !Intersect )
+      {
+        for( ; i != na; ++i ) o = set_write(eve::read(a + i), o);
+      }
+      return o;
+    }
+  }
+
+  template <typename TraitsSupport>
+  struct set_intersection_ : TraitsSupport
+  {
+    template <relaxed_range R1, relaxed_range R2, relaxed_iterator O>
+    EVE_FORCEINLINE auto operator()(R1&& r1, R2&& r2, O out) const
+    {
+      if( r1.begin() == r1.end() || r2.begin() == r2.end() ) return out;
+
+      auto [a, na, b, nb, o] = detail::set_operation_setup(TraitsSupport::get_traits(), EVE_FWD(r1), EVE_FWD(r2), out);
+      auto first             = o;
+
+      using wide_t               = wide_value_type_t<decltype(a)>;
+      constexpr std::ptrdiff_t N = wide_t::size();
+
+      std::ptrdiff_t i = 0, j = 0;
+      while( i + N <= na && j + N <= nb )
+      {
+        wide_t va = eve::load(a + i);
+        wide_t vb = eve::load(b + j);
+
+        // Elements are unique: a match can not be found again in the next block.
+        o = detail::set_store(va, detail::match_any(va, vb), o);
+
+        auto a_max = va.get(N - 1);
+        auto b_max = vb.get(N - 1);
+        if( a_max <= b_max ) i += N;
+        if( b_max <= a_max ) j += N;
+      }
+
+      o = detail::set_filter_tail<true>(a, i, na, b, j, nb, o);
+      return out + (o - first);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var set_intersection
+  //!  @brief Writes the elements of a sorted set that are also in another one
+  //!
+  //!  Blocks of a wide from each input are compared all against all (one comparison with every
+  //!  lane of the other block broadcast), the matches are written with `compress_store`.
+  //!  The block with the smallest last element is then replaced by the next one.
+  //!  The elements left once one input has less than a wide remaining are merged one by one.
+  //!
+  //!  @note
+  //!         * Both inputs have to be strictly increasing (no duplicates),
+  //!           for example posting lists.
+  //!         * Only the elements written are touched in the output.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range R1, relaxed_range R2, relaxed_iterator O>
+  //!     O set_intersection(R1&& r1, R2&& r2, O out);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `r1`, `r2`: Relaxed input ranges, strictly increasing, of the same value type
+  //!    * `out`: Relaxed iterator to the beginning of the destination
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator past the last element written.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/set_operations.cpp}
+  //!
+  //!   @see set_union
+  //!   @see set_difference
+  //! @}
+  //================================================================================================
+  inline constexpr auto set_intersection = function_with_traits<set_intersection_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct set_difference_ : TraitsSupport
+  {
+    template <relaxed_range R1, relaxed_range R2, relaxed_iterator O>
+    EVE_FORCEINLINE auto operator()(R1&& r1, R2&& r2, O out) const
+    {
+      if( r1.begin() == r1.end() ) return out;
+
+      auto [a, na, b, nb, o] = detail::set_operation_setup(TraitsSupport::get_traits(), EVE_FWD(r1), EVE_FWD(r2), out);
+      auto first             = o;
+
+      using wide_t               = wide_value_type_t<decltype(a)>;
+      constexpr std::ptrdiff_t N = wide_t::size();
+
+      std::ptrdiff_t i = 0, j = 0;
+      if( i + N <= na && j + N <= nb )
+      {
+        // Lanes of the current block of `a` found in any block of `b` so far.
+        auto matched = eve::false_(eve::as<wide_t>{});
+
+        while( true )
+        {
+          wide_t va = eve::load(a + i);
+          wide_t vb = eve::load(b + j);
+          matched   = matched || detail::match_any(va, vb);
+
+          auto a_max = va.get(N - 1);
+          auto b_max = vb.get(N - 1);
+          if( a_max <= b_max )
+          {
+            o       = detail::set_store(va, !matched, o);
+            matched = eve::false_(eve::as<wide_t>{});
+            i += N;
+          }
+          if( b_max <= a_max ) j += N;
+
+          if( i + N > na || j + N > nb ) break;
+        }
+
+        // The current block of `a` may have matched blocks of `b` that were already skipped.
+        if( i != na )
+        {
+          auto x = eve::read(a + i);
+          while( j != 0 && !(eve::read(b + (j - 1)) < x) ) --j;
+        }
+      }
+
+      o = detail::set_filter_tail<false>(a, i, na, b, j, nb, o);
+      return out + (o - first);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var set_difference
+  //!  @brief Writes the elements of a sorted set that are not in another one
+  //!
+  //!  Same block comparisons as eve::algo::set_intersection, the matches of a block of `r1`
+  //!  are accumulated until it is replaced, then the lanes that never matched are written with
+  //!  `compress_store`.
+  //!
+  //!  @note
+  //!         * Both inputs have to be strictly increasing (no duplicates).
+  //!         * Only the elements written are touched in the output.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range R1, relaxed_range R2, relaxed_iterator O>
+  //!     O set_difference(R1&& r1, R2&& r2, O out);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `r1`: Relaxed input range to filter, strictly increasing
+  //!    * `r2`: Relaxed input range of the elements to drop, strictly increasing
+  //!    * `out`: Relaxed iterator to the beginning of the destination
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator past the last element written.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/set_operations.cpp}
+  //!
+  //!   @see set_intersection
+  //!   @see set_union
+  //! @}
+  //================================================================================================
+  inline constexpr auto set_difference = function_with_traits<set_difference_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct set_union_ : TraitsSupport
+  {
+    // Writes sorted values, dropping the ones equal to the previous value written.
+    template <typename UnalignedO, typename T>
+    struct dedup_writer
+    {
+      UnalignedO o;
+      T          last;
+      bool       empty = true;
+
+      template <typename Wide> EVE_FORCEINLINE void write_wide(Wide x)
+      {
+        auto keep = x != eve::slide_right(Wide(last), x, eve::index<1>);
+        if( empty ) keep = keep || eve::logical<Wide>([](auto i, auto) { return i == 0; });
+
+        o     = detail::set_store(x, keep, o);
+        last  = x.get(Wide::size() - 1);
+        empty = false;
+      }
+
+      EVE_FORCEINLINE void write_scalar(T x)
+      {
+        if( !empty && x == last ) return;
+        o     = detail::set_write(x, o);
+        last  = x;
+        empty = false;
+      }
+    };
+
+    template <relaxed_range R1, relaxed_range R2, relaxed_iterator O>
+    EVE_FORCEINLINE auto operator()(R1&& r1, R2&& r2, O out) const
+    {
+      if( r1.begin() == r1.end() && r2.begin() == r2.end() ) return out;
+
+      auto [a, na, b, nb, o] = detail::set_operation_setup(TraitsSupport::get_traits(), EVE_FWD(r1), EVE_FWD(r2), out);
+      auto first             = o;
+
+      using wide_t               = wide_value_type_t<decltype(a)>;
+      using T                    = eve::element_type_t<wide_t>;
+      constexpr std::ptrdiff_t N = wide_t::size();
+
+      dedup_writer<decltype(o), T> w {o, T {}};
+
+      // Elements of the last merge that could still be followed by smaller ones.
+      std::array<T, N> carry;
+      std::ptrdiff_t   c = N;
+
+      std::ptrdiff_t i = 0, j = 0;
+      if( i + N <= na && j + N <= nb )
+      {
+        auto [lo, hi] = detail::merge_sorted_wides(wide_t(eve::load(a + i)), wide_t(eve::load(b + j)));
+        i += N;
+        j += N;
+        w.write_wide(lo);
+
+        // Vectorized merge: the next block comes from the input whose next element is the
+        // smallest, after merging with it the lower half is final.
+        while( true )
+        {
+          if( i == na && j == nb ) break;
+
+          bool from_a = j == nb || (i != na && eve::read(a + i) < eve::read(b + j));
+          if( from_a ? i + N > na : j + N > nb ) break;
+
+          wide_t next = from_a ? wide_t(eve::load(a + i)) : wide_t(eve::load(b + j));
+          if( from_a ) i += N;
+          else         j += N;
+
+          auto [l, h] = detail::merge_sorted_wides(hi, next);
+          w.write_wide(l);
+          hi = h;
+        }
+
+        eve::store(hi, carry.data());
+        c = 0;
+      }
+
+      // Three way scalar merge of the carry and both tails.
+      while( c != N || i != na || j != nb )
+      {
+        int src = -1;
+        T   x {};
+        if( c != N ) { src = 0; x = carry[c]; }
+        if( i != na && (src < 0 || eve::read(a + i) < x) ) { src = 1; x = eve::read(a + i); }
+        if( j != nb && (src < 0 || eve::read(b + j) < x) ) { src = 2; x = eve::read(b + j); }
+
+        if( src == 0 )      ++c;
+        else if( src == 1 ) ++i;
+        else                ++j;
+
+        w.write_scalar(x);
+      }
+
+      return out + (w.o - first);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var set_union
+  //!  @brief Writes the elements that are in either of two sorted sets
+  //!
+  //!  Blocks of a wide are merged with a bitonic merging network: the lower half of the merge
+  //!  is final, the upper half is merged with the next block of the input with the smallest next
+  //!  element. Elements found in both inputs end up next to each other and are dropped with
+  //!  `compress_store` by comparing every lane with the previous one.
+  //!
+  //!  @note
+  //!         * Both inputs have to be sorted. The result is strictly increasing.
+  //!         * Only the elements written are touched in the output.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range R1, relaxed_range R2, relaxed_iterator O>
+  //!     O set_union(R1&& r1, R2&& r2, O out);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `r1`, `r2`: Relaxed input ranges, sorted, of the same value type
+  //!    * `out`: Relaxed iterator to the beginning of the destination
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator past the last element written.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/set_operations.cpp}
+  //!
+  //!   @see set_intersection
+  //!   @see set_difference
+  //! @}
+  //================================================================================================
+  inline constexpr auto set_union = function_with_traits<set_union_>[default_simple_algo_traits];
+}
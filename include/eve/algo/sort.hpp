@@ -0,0 +1,351 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/copy.hpp>
+#include <eve/algo/detail/scratch_buffer.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <algorithm>
+
+namespace eve::algo
+{
+  namespace detail
+  {
+    // The key of a value is the value itself or its first component for product types.
+    template<typename T> EVE_FORCEINLINE auto sort_key(T x)
+    {
+      if constexpr( kumi::product_type<T> ) return get<0>(x);
+      else                                  return x;
+    }
+
+    template<typename T> EVE_FORCEINLINE auto sort_padding(eve::as<T>)
+    {
+      if constexpr( kumi::product_type<T> )
+      {
+        T res {};
+        get<0>(res) = sort_padding(eve::as<std::remove_cvref_t<decltype(get<0>(res))>>{});
+        return res;
+      }
+      else if constexpr( std::floating_point<T> ) return eve::inf(eve::as<T>{});
+      else                                        return eve::valmax(eve::as<T>{});
+    }
+
+    // lane i of `x` is compared with lane i ^ G.
+    // `take_min` lanes receive the smallest of the two, the other ones the biggest.
+    template<std::ptrdiff_t G, typename Wide, typename Mask>
+    EVE_FORCEINLINE Wide sort_compare_exchange(Wide x, Mask take_min)
+    {
+      Wide p = eve::swap_adjacent_groups(x, eve::fixed<G> {});
+      if constexpr( !kumi::product_type<Wide> ) return eve::if_else(take_min, eve::min(x, p), eve::max(x, p));
+      else
+      {
+        auto kx           = sort_key(x);
+        auto kp           = sort_key(p);
+        auto from_partner = eve::if_else(take_min, kp < kx, kx < kp);
+        return eve::if_else(from_partner, p, x);
+      }
+    }
+
+    // One step of the bitonic sorter: K is the size of the sorted blocks being built,
+    // J is the distance between compared lanes.
+    template<std::ptrdiff_t K, std::ptrdiff_t J, typename Wide>
+    EVE_FORCEINLINE Wide bitonic_steps(Wide x)
+    {
+      using key_t = std::remove_cvref_t<decltype(sort_key(x))>;
+
+      eve::logical<key_t> take_min([](auto i, auto) { return ((i & J) == 0) == ((i & K) == 0); });
+      x = sort_compare_exchange<J>(x, take_min);
+
+      if constexpr( J > 1 ) return bitonic_steps<K, J / 2>(x);
+      else                  return x;
+    }
+
+    template<std::ptrdiff_t K, typename Wide>
+    EVE_FORCEINLINE Wide bitonic_sort(Wide x)
+    {
+      if constexpr( K > Wide::size() ) return x;
+      else                             return bitonic_sort<K * 2>(bitonic_steps<K, K / 2>(x));
+    }
+
+    // Sorts the lanes of a wide in ascending order.
+    template<typename Wide> EVE_FORCEINLINE Wide sort_wide(Wide x)
+    {
+      return bitonic_sort<2>(x);
+    }
+
+    // Merges two sorted wides, returns the smallest half and the biggest half, both sorted.
+    template<typename Wide> EVE_FORCEINLINE kumi::tuple<Wide, Wide> merge_sorted_wides(Wide a, Wide b)
+    {
+      b = eve::reverse(b);
+
+      Wide lo, hi;
+      if constexpr( !kumi::product_type<Wide> )
+      {
+        lo = eve::min(a, b);
+        hi = eve::max(a, b);
+      }
+      else
+      {
+        auto from_b = sort_key(b) < sort_key(a);
+        lo          = eve::if_else(from_b, b, a);
+        hi          = eve::if_else(from_b, a, b);
+      }
+
+      if constexpr( Wide::size() > 1 )
+      {
+        lo = bitonic_steps<Wide::size(), Wide::size() / 2>(lo);
+        hi = bitonic_steps<Wide::size(), Wide::size() / 2>(hi);
+      }
+      return {lo, hi};
+    }
+
+    template<typename Wide> struct sort_kernels
+    {
+      static constexpr std::ptrdiff_t N = Wide::size();
+
+      Wide pad;
+
+      EVE_FORCEINLINE Wide load_padded(auto it, std::ptrdiff_t n) const
+      {
+        if( n >= N ) return eve::load(it);
+        eve::keep_first cond {n};
+        return eve::if_else(cond, eve::load[cond](it), pad);
+      }
+
+      EVE_FORCEINLINE void store_first(Wide x, auto it, std::ptrdiff_t n) const
+      {
+        if( n >= N ) eve::store(x, it);
+        else         eve::store[eve::keep_first(n)](x, it);
+      }
+
+      // Sorts every block of N elements in place.
+      void sort_blocks(auto f, std::ptrdiff_t n) const
+      {
+        for( std::ptrdiff_t i = 0; i < n; i += N ) store_first(sort_wide(load_padded(f + i, n - i)), f + i, n - i);
+      }
+
+      // Merges [a, a + la) and [b, b + lb) into out.
+      // la and lb are expected to be multiples of N, apart from the last run of the range.
+      // Partial wides are padded with the biggest key, which can only go to the end.
+      void merge(auto a, std::ptrdiff_t la, auto b, std::ptrdiff_t lb, auto out) const
+      {
+        Wide           wa   = load_padded(a, la);
+        Wide           wb   = load_padded(b, lb);
+        std::ptrdiff_t ia   = N;
+        std::ptrdiff_t ib   = N;
+        std::ptrdiff_t left = la + lb;
+
+        while( true )
+        {
+          auto [lo, hi] = merge_sorted_wides(wa, wb);
+          store_first(lo, out, left);
+          left -= N;
+          if( left <= 0 ) return;
+          out += N;
+          wb = hi;
+
+          bool take_a;
+          if( ia >= la )
+          {
+            if( ib >= lb ) break;
+            take_a = false;
+          }
+          else if( ib >= lb ) take_a = true;
+          else take_a = !(sort_key(eve::read(b + ib)) < sort_key(eve::read(a + ia)));
+
+          if( take_a )
+          {
+            wa = load_padded(a + ia, la - ia);
+            ia += N;
+          }
+          else
+          {
+            wa = load_padded(b + ib, lb - ib);
+            ib += N;
+          }
+        }
+
+        store_first(wb, out, left);
+      }
+
+      // One level of the bottom up merge sort: merges pairs of runs of width w from src to dst.
+      void merge_level(auto src, auto dst, std::ptrdiff_t n, std::ptrdiff_t w) const
+      {
+        for( std::ptrdiff_t s = 0; s < n; s += 2 * w )
+        {
+          std::ptrdiff_t la = std::min(w, n - s);
+          std::ptrdiff_t lb = std::min(w, n - s - la);
+
+          if( lb == 0 ) eve::algo::copy(as_range(src + s, src + s + la), dst + s);
+          else          merge(src + s, la, src + s + la, lb, dst + s);
+        }
+      }
+    };
+
+    template<typename Traits, typename Rng> EVE_FORCEINLINE void sort_impl(Traits tr, Rng&& rng)
+    {
+      auto processed = preprocess_range(tr, EVE_FWD(rng));
+
+      using I      = unaligned_t<decltype(processed.begin())>;
+      using N      = iterator_cardinal_t<I>;
+      using T      = value_type_t<I>;
+      using wide_t = eve::wide<T, N>;
+
+      I              f = unalign(processed.begin());
+      std::ptrdiff_t n = processed.end() - processed.begin();
+
+      if( n < 2 ) return;
+
+      sort_kernels<wide_t> kernels {wide_t(sort_padding(eve::as<T> {}))};
+      kernels.sort_blocks(f, n);
+
+      if( n <= N() ) return;
+
+      auto buffer     = make_scratch_buffer<T>(n);
+      auto buffer_rng = preprocess_range(algo::traits(force_cardinal<N::value>), buffer);
+      auto b          = unalign(buffer_rng.begin());
+
+      bool in_buffer = false;
+      for( std::ptrdiff_t w = N(); w < n; w *= 2 )
+      {
+        if( in_buffer ) kernels.merge_level(b, f, n, w);
+        else            kernels.merge_level(f, b, n, w);
+        in_buffer = !in_buffer;
+      }
+
+      if( in_buffer ) eve::algo::copy(as_range(b, b + n), f);
+    }
+  }
+
+  template<typename TraitsSupport> struct sort_ : TraitsSupport
+  {
+    template<relaxed_range Rng> EVE_FORCEINLINE void operator()(Rng&& rng) const
+    {
+      static_assert(eve::plain_scalar_value<value_type_t<Rng>>,
+                    "eve::algo::sort only supports arithmetic types, use sort_by_key for tuples");
+      detail::sort_impl(TraitsSupport::get_traits(), EVE_FWD(rng));
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var sort
+  //!
+  //!  @brief SIMD sorting of arithmetic values in ascending order
+  //!
+  //!  Each wide worth of elements is sorted in register with a bitonic sorting network,
+  //!  then sorted runs are merged two wides at a time with a bitonic merge network.
+  //!  Uses a temporary buffer of the size of the range.
+  //!
+  //!  @note
+  //!         * The sort is not stable, which is undetectable for arithmetic types.
+  //!         * NaNs are not supported (same as with `std::sort`, they are not strictly ordered).
+  //!         * `force_cardinal` trait is supported, other traits are ignored.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <eve::algo::relaxed_range Rng>
+  //!     void sort(Rng&& rng);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range of arithmetic values to sort
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/sort.cpp}
+  //!
+  //!   @see sort_by_key
+  //! @}
+  //================================================================================================
+  inline constexpr auto sort = function_with_traits<sort_>[no_traits];
+
+  template<typename TraitsSupport> struct sort_by_key_ : TraitsSupport
+  {
+    template<relaxed_range Rng> EVE_FORCEINLINE void operator()(Rng&& rng) const
+    {
+      static_assert(kumi::product_type<value_type_t<Rng>>,
+                    "eve::algo::sort_by_key expects a range of tuples, sorted by their first component");
+      detail::sort_impl(TraitsSupport::get_traits(), EVE_FWD(rng));
+    }
+
+    template<typename R1, typename R2>
+      requires zip_to_range<R1, R2>
+    EVE_FORCEINLINE void operator()(R1&& keys, R2&& values) const
+    {
+      operator()(views::zip(EVE_FWD(keys), EVE_FWD(values)));
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var sort_by_key
+  //!
+  //!  @brief SIMD sorting of tuples by their first component
+  //!
+  //!  Same algorithm as eve::algo::sort, the other components are moved along with their key.
+  //!  Works with eve::algo::views::zip and eve::algo::soa_vector.
+  //!
+  //!  @note The sort is not stable.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <eve::algo::relaxed_range Rng>
+  //!     void sort_by_key(Rng&& rng);                                           // 1
+  //!
+  //!     template <typename R1, typename R2>
+  //!     void sort_by_key(R1&& keys, R2&& values) requires zip_to_range<R1, R2>; // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   1. Sorts a range of tuples by their first component.
+  //!   2. Same as `sort_by_key(eve::views::zip(keys, values))`.
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`:    Relaxed input range of tuples
+  //!    * `keys`:   Relaxed range or iterator of keys
+  //!    * `values`: Relaxed range or iterator of values
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/sort.cpp}
+  //!
+  //!   @see sort
+  //! @}
+  //================================================================================================
+  inline constexpr auto sort_by_key = function_with_traits<sort_by_key_>[no_traits];
+}
@@ -0,0 +1,161 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/byte_classifier.hpp>
+#include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/to_bitmask.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/module/core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace eve::algo
+{
+namespace detail
+{
+  // Bit i of the result is the xor of the bits 0 to i of x:
+  // set between an opening quote (included) and a closing one (excluded).
+  constexpr std::uint64_t prefix_xor(std::uint64_t x)
+  {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+  }
+}
+
+template<typename TraitsSupport> struct split_positions_ : TraitsSupport
+{
+  template<relaxed_range Rng, relaxed_iterator O>
+  EVE_FORCEINLINE auto operator()(Rng&& rng, O out, byte_classifier const& separators, std::uint8_t quote) const
+  {
+    using T = value_type_t<Rng>;
+    static_assert(std::integral<T> && sizeof(T) == 1, "eve::algo::split_positions works on bytes");
+
+    if( rng.begin() == rng.end() ) return out;
+
+    auto tr        = TraitsSupport::get_traits();
+    auto processed = preprocess_range(tr, EVE_FWD(rng));
+    auto f         = unalign(processed.begin());
+
+    std::ptrdiff_t n = processed.end() - processed.begin();
+
+    auto o     = unalign(preprocess_range(eve::algo::traits(), as_range(out, out + n)).begin());
+    auto first = o;
+    using idx_t = value_type_t<decltype(o)>;
+
+    // Bitmasks are computed for blocks that stay in L1, then scanned word by word.
+    constexpr std::ptrdiff_t                   words_per_block = 64;
+    std::array<std::uint64_t, words_per_block> seps, quotes;
+
+    // All ones if the previous word ended inside of quotes.
+    std::uint64_t inside = 0;
+
+    for( std::ptrdiff_t i = 0; i < n; i += 64 * words_per_block )
+    {
+      std::ptrdiff_t len   = std::min(64 * words_per_block, n - i);
+      auto           block = as_range(f + i, f + i + len);
+
+      to_bitmask[tr](block, seps.data(), separators);
+      to_bitmask[tr](block, quotes.data(), equal_to {static_cast<T>(quote)});
+
+      for( std::ptrdiff_t w = 0; w * 64 < len; ++w )
+      {
+        std::uint64_t quoted = detail::prefix_xor(quotes[w]) ^ inside;
+        inside               = static_cast<std::uint64_t>(static_cast<std::int64_t>(quoted) >> 63);
+
+        std::uint64_t  bits = seps[w] & ~quoted;
+        std::ptrdiff_t base = i + 64 * w;
+        while( bits )
+        {
+          eve::write(static_cast<idx_t>(base + std::countr_zero(bits)), o);
+          ++o;
+          bits &= bits - 1;
+        }
+      }
+    }
+
+    return out + (o - first);
+  }
+
+  template<relaxed_range Rng, relaxed_iterator O>
+  EVE_FORCEINLINE auto operator()(Rng&& rng, O out, byte_classifier const& separators) const
+  {
+    return operator()(EVE_FWD(rng), out, separators, std::uint8_t {'"'});
+  }
+};
+
+//================================================================================================
+//! @addtogroup algos
+//! @{
+//!  @var split_positions
+//!
+//!  @brief Writes the offsets of the field separators of a delimited text (CSV...)
+//!
+//!  Writes the position of every byte that is in `separators` and not between quotes,
+//!  in increasing order. Typically `separators` contains the delimiter and the new line.
+//!
+//!  The separators and the quotes are turned into bitmasks with eve::algo::to_bitmask,
+//!  64 bytes per word. For every word, the bytes between quotes are the prefix xor of the quotes
+//!  bits (carried over from the previous word), they are removed from the separators.
+//!  The positions of the bits left are then written.
+//!
+//!  Doubled quotes (escaped quotes in CSV) close and reopen the quoted field, which gives the
+//!  correct result.
+//!
+//!  @note
+//!         * The output has to have room for one offset per byte of the input in the worst case.
+//!         * The offset type has to be able to hold the size of the input.
+//!
+//!   **Alternative Header**
+//!
+//!   @code
+//!   #include <eve/algo.hpp>
+//!   @endcode
+//!
+//!   @groupheader{Callable Signatures}
+//!
+//!   @code
+//!   namespace eve::algo
+//!   {
+//!     template <eve::algo::relaxed_range Rng, eve::algo::relaxed_iterator O>
+//!     O split_positions(Rng&& rng, O out, byte_classifier const& separators, std::uint8_t quote = '"');
+//!   }
+//!   @endcode
+//!
+//!   **Parameters**
+//!
+//!    * `rng`: Relaxed input range of bytes
+//!    * `out`: Relaxed iterator to the beginning of the offsets
+//!    * `separators`: Bytes ending a field
+//!    * `quote`: Byte opening and closing quoted parts
+//!
+//!   **Return value**
+//!
+//!   Iterator past the last offset written.
+//!
+//!   @groupheader{Example}
+//!
+//!   @godbolt{doc/algo/split_positions.cpp}
+//!
+//!   @see byte_classifier
+//!   @see to_bitmask
+//! @}
+//================================================================================================
+inline constexpr auto split_positions = function_with_traits<split_positions_>[default_simple_algo_traits];
+}
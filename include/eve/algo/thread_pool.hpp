@@ -0,0 +1,169 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eve::algo
+{
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!   @struct thread_pool
+  //!
+  //!   @brief Persistent set of worker threads used by the eve::algo::parallel trait.
+  //!
+  //!   `run(n, f)` calls `f(i)` for every `i` in `[0, n)`, distributing the indexes between the
+  //!   workers and the calling thread, and returns once all of them are done.
+  //!   Only one `run` is active at a time. Calls to `run` from inside a task are executed inline
+  //!   on the current thread, so nested parallel algorithms do not deadlock.
+  //!
+  //!   @note Tasks must not throw.
+  //!
+  //!   **Required header:** `#include <eve/algo/thread_pool.hpp>`
+  //! @}
+  //================================================================================================
+  struct thread_pool
+  {
+    explicit thread_pool(std::size_t concurrency)
+    {
+      concurrency = std::max(concurrency, std::size_t{1});
+      for( std::size_t i = 1; i != concurrency; ++i ) workers_.emplace_back([this] { work(); });
+    }
+
+    thread_pool(thread_pool const&)            = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+
+    ~thread_pool()
+    {
+      {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+      }
+      has_work_.notify_all();
+      for( auto& w : workers_ ) w.join();
+    }
+
+    // Number of threads that execute tasks, including the caller of `run`.
+    std::size_t concurrency() const { return workers_.size() + 1; }
+
+    template<typename F> void run(std::size_t n, F&& f)
+    {
+      if( n == 0 ) return;
+
+      if( n == 1 || workers_.empty() || inside_task() )
+      {
+        for( std::size_t i = 0; i != n; ++i ) f(i);
+        return;
+      }
+
+      std::lock_guard serialize(run_mutex_);
+
+      job j;
+      j.invoke = [](void* data, std::size_t i) { (*static_cast<std::remove_reference_t<F>*>(data))(i); };
+      j.data   = &f;
+      j.size   = n;
+
+      {
+        std::lock_guard lock(mutex_);
+        current_ = &j;
+        ++generation_;
+      }
+      has_work_.notify_all();
+
+      execute(j);
+
+      std::unique_lock lock(mutex_);
+      done_.wait(lock, [&] { return active_ == 0 && j.finished.load() == n; });
+      current_ = nullptr;
+    }
+
+    private:
+    struct job
+    {
+      void (*invoke)(void*, std::size_t);
+      void*                    data;
+      std::size_t              size;
+      std::atomic<std::size_t> next     = 0;
+      std::atomic<std::size_t> finished = 0;
+    };
+
+    static bool& inside_task()
+    {
+      static thread_local bool inside = false;
+      return inside;
+    }
+
+    void execute(job& j)
+    {
+      inside_task() = true;
+      std::size_t i;
+      while( (i = j.next.fetch_add(1)) < j.size )
+      {
+        j.invoke(j.data, i);
+        j.finished.fetch_add(1);
+      }
+      inside_task() = false;
+    }
+
+    void work()
+    {
+      std::uint64_t seen = 0;
+      while( true )
+      {
+        job* j = nullptr;
+        {
+          std::unique_lock lock(mutex_);
+          has_work_.wait(lock, [&] { return stop_ || (current_ && generation_ != seen); });
+          if( stop_ ) return;
+          seen = generation_;
+          j    = current_;
+          ++active_;
+        }
+
+        execute(*j);
+
+        {
+          std::lock_guard lock(mutex_);
+          --active_;
+        }
+        done_.notify_all();
+      }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex               run_mutex_;
+    std::mutex               mutex_;
+    std::condition_variable  has_work_;
+    std::condition_variable  done_;
+    job*                     current_    = nullptr;
+    std::uint64_t            generation_ = 0;
+    std::size_t              active_     = 0;
+    bool                     stop_       = false;
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!   @brief Returns the process wide eve::algo::thread_pool used by the eve::algo::parallel
+  //!   trait. It is created on first use with `std::thread::hardware_concurrency()` threads.
+  //! @}
+  //================================================================================================
+  inline thread_pool& global_thread_pool()
+  {
+    static thread_pool pool(std::thread::hardware_concurrency());
+    return pool;
+  }
+}
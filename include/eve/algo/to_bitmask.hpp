@@ -0,0 +1,141 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/module/core.hpp>
+
+#include <cstdint>
+
+namespace eve::algo
+{
+namespace detail
+{
+  // One bit per lane, lane 0 being the lowest bit.
+  template<typename Logical> EVE_FORCEINLINE std::uint64_t lane_bits(Logical mask)
+  {
+    eve::top_bits bits {mask};
+    using bits_t = decltype(bits);
+
+    if constexpr( bits_t::bits_per_element == 1 && bits_t::static_bits_size <= 64 )
+    {
+      return static_cast<std::uint64_t>(bits.as_int());
+    }
+    else
+    {
+      std::uint64_t res = 0;
+      for( std::ptrdiff_t i = 0; i != Logical::size(); ++i )
+      {
+        res |= static_cast<std::uint64_t>(bits.get(i)) << i;
+      }
+      return res;
+    }
+  }
+}
+
+template<typename TraitsSupport> struct to_bitmask_ : TraitsSupport
+{
+  template<relaxed_range Rng, relaxed_iterator O, typename P>
+  EVE_FORCEINLINE auto operator()(Rng&& rng, O out, P p) const
+  {
+    if( rng.begin() == rng.end() ) return out;
+
+    auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
+    auto f         = unalign(processed.begin());
+
+    using N = iterator_cardinal_t<decltype(f)>;
+    static_assert(N::value <= 64, "eve::algo::to_bitmask: a wide has to fit in a word");
+
+    constexpr std::ptrdiff_t card  = N::value;
+    std::ptrdiff_t           n     = processed.end() - processed.begin();
+    std::ptrdiff_t           words = (n + 63) / 64;
+
+    auto o = unalign(preprocess_range(eve::algo::traits(), as_range(out, out + words)).begin());
+
+    // Full wides are processed without masking, only the last one is partial.
+    std::ptrdiff_t i = 0;
+    for( ; i + 64 <= n; i += 64, ++o )
+    {
+      std::uint64_t word = 0;
+      for( std::ptrdiff_t k = 0; k != 64; k += card ) word |= detail::lane_bits(p(eve::load(f + i + k))) << k;
+      eve::write(word, o);
+    }
+
+    if( i != n )
+    {
+      std::uint64_t word = 0;
+      for( std::ptrdiff_t k = 0; i + k < n; k += card )
+      {
+        auto mask = [&]
+        {
+          if( i + k + card <= n ) return p(eve::load(f + i + k));
+          eve::keep_first ignore {n - i - k};
+          return eve::replace_ignored(p(eve::load[ignore](f + i + k)), ignore, false);
+        }();
+        word |= detail::lane_bits(mask) << k;
+      }
+      eve::write(word, o);
+    }
+
+    return out + words;
+  }
+};
+
+//================================================================================================
+//! @addtogroup algos
+//! @{
+//!  @var to_bitmask
+//!
+//!  @brief Writes the result of a predicate as bits
+//!
+//!  Bit `i % 64` of word `i / 64` of the output is set if `p` is true for the element `i`.
+//!  The bits after the last element are 0. Masks are turned into bits with eve::top_bits
+//!  (`movemask`), one wide at a time.
+//!
+//!  Together with eve::algo::byte_classifier, this gives the positions of all of the structural
+//!  characters of a text (separators, quotes, new lines...) for a parser to iterate on with bit
+//!  tricks, or to combine with other bitmasks.
+//!
+//!   **Alternative Header**
+//!
+//!   @code
+//!   #include <eve/algo.hpp>
+//!   @endcode
+//!
+//!   @groupheader{Callable Signatures}
+//!
+//!   @code
+//!   namespace eve::algo
+//!   {
+//!     template <eve::algo::relaxed_range Rng, eve::algo::relaxed_iterator O, typename P>
+//!     O to_bitmask(Rng&& rng, O out, P p);
+//!   }
+//!   @endcode
+//!
+//!   **Parameters**
+//!
+//!    * `rng`: Relaxed input range to process
+//!    * `out`: Relaxed iterator to `(size + 63) / 64` `std::uint64_t`
+//!    * `p`: Predicate taking a wide and returning a logical
+//!
+//!   **Return value**
+//!
+//!   Iterator past the last word written.
+//!
+//!   @groupheader{Example}
+//!
+//!   @godbolt{doc/algo/find_first_of.cpp}
+//!
+//!   @see byte_classifier
+//! @}
+//================================================================================================
+inline constexpr auto to_bitmask = function_with_traits<to_bitmask_>[default_simple_algo_traits];
+}
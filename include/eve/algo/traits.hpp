@@ -88,6 +88,32 @@ namespace eve::algo
   //================================================================================================
   inline constexpr auto no_aligning = ::rbr::flag( no_aligning_tag{} );
 
+  struct parallel_tag {};
+
+  //================================================================================================
+  //! @addtogroup algorithms
+  //! @{
+  //!   @var parallel
+  //!
+  //!   @brief Traits for running an algorithm on multiple threads
+  //!
+  //!   Splits the range into subranges which boundaries respect the iteration alignment and
+  //!   processes them on an eve::algo::thread_pool (eve::algo::global_thread_pool() unless
+  //!   `thread_pool_key` is specified). Partial results are then merged on the calling thread.
+  //!
+  //!   The size of each subrange is at least `parallel_job_size<N>` elements
+  //!   (by default - 64KB worth of elements).
+  //! @}
+  //================================================================================================
+  inline constexpr auto parallel = ::rbr::flag( parallel_tag{} );
+
+  struct parallel_job_size_key_t {};
+  inline constexpr auto parallel_job_size_key = ::rbr::keyword( parallel_job_size_key_t{} );
+  template <std::ptrdiff_t N> inline constexpr auto parallel_job_size = (parallel_job_size_key = eve::index<N>);
+
+  struct thread_pool_key_t {};
+  inline constexpr auto thread_pool_key = ::rbr::keyword( thread_pool_key_t{} );
+
   // getters -------------------
 
   template <typename Traits>
@@ -96,6 +122,12 @@ namespace eve::algo
     return rbr::result::fetch_t<(unroll_key | index<1>), Traits>{};
   }
 
+  template <typename Traits>
+  constexpr std::ptrdiff_t get_parallel_job_size()
+  {
+    return rbr::result::fetch_t<(parallel_job_size_key | index<0>), Traits>{};
+  }
+
   template <typename Traits>
   using extra_types_to_consider = rbr::result::fetch_t<(consider_types_key | kumi::tuple{}), Traits>;
 
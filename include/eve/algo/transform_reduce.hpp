@@ -8,6 +8,7 @@
 #pragma once
 
 #include <eve/algo/array_utils.hpp>
+#include <eve/algo/detail/parallel.hpp>
 #include <eve/algo/for_each_iteration.hpp>
 #include <eve/algo/preprocess_range.hpp>
 #include <eve/algo/traits.hpp>
@@ -16,6 +17,7 @@
 #include <eve/traits.hpp>
 
 #include <utility>
+#include <vector>
 
 namespace eve::algo
 {
@@ -56,11 +58,9 @@ template<typename TraitsSupport> struct transform_reduce_ : TraitsSupport
       return false;
     }
 
-    EVE_FORCEINLINE auto finish()
-    {
-      auto sum = array_reduce(sums, add_op);
-      return eve::reduce(sum, add_op);
-    }
+    EVE_FORCEINLINE SumWide partial() { return array_reduce(sums, add_op); }
+
+    EVE_FORCEINLINE auto finish() { return eve::reduce(partial(), add_op); }
   };
 
   template<eve::algo::relaxed_range Rng, typename MapOp, typename AddOp, typename Zero, typename U>
@@ -79,11 +79,33 @@ template<typename TraitsSupport> struct transform_reduce_ : TraitsSupport
     sum_wide_t init_as_wide = eve::as_value(add_zero.second, as<sum_wide_t> {});
     init_as_wide.set(0, init);
 
-    delegate<MapOp, AddOp, Zero, sum_wide_t> d {
-        map_op, add_zero.first, add_zero.second, init_as_wide};
+    if constexpr( decltype(processed.traits())::contains(parallel) )
+    {
+      detail::parallel_iteration iteration {processed.traits(), processed.begin(), processed.end()};
+      std::vector<sum_wide_t>    partials(iteration.size());
+
+      iteration(
+          [&](std::size_t i, auto tr, auto f, auto l)
+          {
+            sum_wide_t sub_init = i ? eve::as_value(add_zero.second, as<sum_wide_t> {}) : init_as_wide;
+            delegate<MapOp, AddOp, Zero, sum_wide_t> d {
+                map_op, add_zero.first, add_zero.second, sub_init};
+            algo::for_each_iteration(tr, f, l)(d);
+            partials[i] = d.partial();
+          });
+
+      sum_wide_t sum = partials[0];
+      for( std::size_t i = 1; i != partials.size(); ++i ) sum = add_zero.first(sum, partials[i]);
+      return eve::reduce(sum, add_zero.first);
+    }
+    else
+    {
+      delegate<MapOp, AddOp, Zero, sum_wide_t> d {
+          map_op, add_zero.first, add_zero.second, init_as_wide};
 
-    algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
-    return d.finish();
+      algo::for_each_iteration(processed.traits(), processed.begin(), processed.end())(d);
+      return d.finish();
+    }
   }
 
   template<eve::algo::relaxed_range Rng, typename MapOp, typename U>
@@ -0,0 +1,323 @@
+//==================================================================================================
+/*
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+*/
+//==================================================================================================
+#pragma once
+
+#include <eve/module/core.hpp>
+#include <eve/algo/array_utils.hpp>
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/common_forceinline_lambdas.hpp>
+#include <eve/algo/concepts.hpp>
+#include <eve/algo/for_each_iteration.hpp>
+#include <eve/algo/preprocess_range.hpp>
+#include <eve/algo/traits.hpp>
+#include <eve/algo/transform.hpp>
+#include <eve/algo/views/zip.hpp>
+
+#include <array>
+
+namespace eve::algo
+{
+  namespace detail
+  {
+    // Iteration over the elements after the first one, each lane is compared to its predecessor.
+    //
+    // `prev` holds the previous wide (only its last lane is used).
+    // It starts as a splat of the first element and fills the lanes that are ignored by the
+    // aligning first step, so that the lane before the first one processed is always correct.
+    template <typename Wide, typename Eq>
+    struct adjacent_carry
+    {
+      Wide prev;
+      Eq   eq;
+
+      // Returns the loaded wide and the lanes that differ from their predecessor.
+      EVE_FORCEINLINE auto load_and_compare(auto it, eve::relative_conditional_expr auto ignore)
+      {
+        auto loaded = eve::load[ignore.else_(prev)](it);
+        auto starts = !eq(loaded, eve::slide_right(prev, loaded, eve::index<1>));
+        prev        = loaded;
+        return kumi::tuple{loaded, starts};
+      }
+    };
+
+    template <typename Traits, typename I, typename S>
+    EVE_FORCEINLINE auto adjacent_iteration(Traits tr, I f, S l)
+    {
+      // Removing the first element breaks divisibility.
+      return algo::for_each_iteration(drop_key(divisible_by_cardinal, tr), unalign(f) + 1, unalign(l));
+    }
+
+    struct rle_counts
+    {
+      // (this run, next run) -> (this value, next start - this start)
+      EVE_FORCEINLINE auto operator()(auto runs) const
+      {
+        auto [next, cur] = runs;
+        return eve::zip(get<0>(cur), get<1>(next) - get<1>(cur));
+      }
+    };
+  }
+
+  template <typename TraitsSupport>
+  struct unique_ : TraitsSupport
+  {
+    template <typename UnalignedI, typename Carry>
+    struct delegate
+    {
+      delegate(UnalignedI out, Carry carry) : out(out), carry(carry) {}
+
+      EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+      {
+        auto [loaded, starts] = carry.load_and_compare(it, ignore);
+        // Same as remove_if: writing in place never overtakes the reading.
+        out = unsafe(compress_store[ignore])(loaded, starts, out);
+        return false;
+      }
+
+      template <typename I, std::size_t size>
+      EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+      {
+        array_map(arr, call_single_step(this));
+        return false;
+      }
+
+      UnalignedI out;
+      Carry      carry;
+    };
+
+    template <relaxed_range Rng, typename Eq>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, Eq eq) const
+    {
+      if (rng.begin() == rng.end()) return unalign(rng.begin());
+
+      auto processed = preprocess_range(TraitsSupport::get_traits(), EVE_FWD(rng));
+      auto f         = unalign(processed.begin());
+
+      if (processed.end() - processed.begin() == 1) return unalign(rng.begin()) + 1;
+
+      using wide_t = wide_value_type_t<decltype(f)>;
+      detail::adjacent_carry<wide_t, Eq> carry{wide_t(eve::read(f)), eq};
+
+      auto iteration = detail::adjacent_iteration(processed.traits(), f, processed.end());
+      delegate<decltype(f), decltype(carry)> d{unalign(iteration.base), carry};
+      iteration(d);
+
+      return unalign(rng.begin()) + (d.out - f);
+    }
+
+    template <relaxed_range Rng>
+    EVE_FORCEINLINE auto operator()(Rng&& rng) const
+    {
+      return operator()(EVE_FWD(rng), eve::is_equal);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var unique
+  //!  @brief SIMD version of std::unique
+  //!
+  //!  Removes all but the first element of every group of consecutive equal elements.
+  //!  Each wide is compared to itself slid right by one lane (the previous wide providing the
+  //!  first lane), the first elements of the groups are then compacted in place with
+  //!  `compress_store`.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, typename Eq>
+  //!     unaligned_t<iterator_t<Rng>> unique(Rng&& rng, Eq eq = eve::is_equal);
+  //!   }
+  //!   @endcode
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed range to process
+  //!    * `eq`: Equality taking two wides and returning a logical
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator past the last element kept.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/unique.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto unique = function_with_traits<unique_>[default_simple_algo_traits];
+
+  template <typename TraitsSupport>
+  struct run_length_encode_ : TraitsSupport
+  {
+    template <typename UnalignedI, typename UnalignedO, typename Carry>
+    struct delegate
+    {
+      delegate(UnalignedI first, UnalignedO out, Carry carry) : first(first), out(out), carry(carry) {}
+
+      EVE_FORCEINLINE bool step(auto it, eve::relative_conditional_expr auto ignore, auto /*idx*/)
+      {
+        using out_t   = value_type_t<UnalignedO>;
+        using value_t = std::remove_cvref_t<decltype(get<0>(std::declval<out_t>()))>;
+        using count_t = std::remove_cvref_t<decltype(get<1>(std::declval<out_t>()))>;
+        using N       = iterator_cardinal_t<UnalignedI>;
+
+        auto [loaded, starts] = carry.load_and_compare(it, ignore);
+
+        // Positions of the runs starts for now, turned into counts afterwards.
+        eve::wide<count_t, N> positions([](auto i, auto) { return i; });
+        positions += static_cast<count_t>(unalign(it) - first);
+
+        auto runs = eve::zip(eve::convert(loaded, eve::as<value_t>{}), positions);
+
+        // We don't own the memory after the output, so the store has to be exact.
+        out = safe(compress_store)(runs, eve::replace_ignored(starts, ignore, false), out);
+        return false;
+      }
+
+      template <typename I, std::size_t size>
+      EVE_FORCEINLINE bool unrolled_step(std::array<I, size> arr)
+      {
+        array_map(arr, call_single_step(this));
+        return false;
+      }
+
+      UnalignedI first;
+      UnalignedO out;
+      Carry      carry;
+    };
+
+    template <relaxed_range Rng, relaxed_iterator O, typename Eq>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, O out, Eq eq) const
+    {
+      if (rng.begin() == rng.end()) return out;
+
+      // zip is only used to agree on the cardinal, the output is advanced separately.
+      auto processed = preprocess_range(TraitsSupport::get_traits(), views::zip(EVE_FWD(rng), out));
+
+      auto           f = unalign(get<0>(processed.begin()));
+      auto           o = unalign(get<1>(processed.begin()));
+      std::ptrdiff_t n = processed.end() - processed.begin();
+
+      using out_t  = value_type_t<decltype(o)>;
+      using wide_t = wide_value_type_t<decltype(f)>;
+
+      auto  first_value = eve::read(f);
+      out_t first_run;
+      get<0>(first_run) = first_value;
+      get<1>(first_run) = 0;
+      eve::write(first_run, o);
+
+      auto last = o + 1;
+      if( n > 1 )
+      {
+        detail::adjacent_carry<wide_t, Eq> carry{wide_t(first_value), eq};
+
+        auto iteration = detail::adjacent_iteration(processed.traits(), f, get<0>(processed.end()));
+        delegate<decltype(f), decltype(o), decltype(carry)> d{f, last, carry};
+        iteration(d);
+        last = d.out;
+      }
+
+      // Starts to counts. Every count only depends on the next start, which is read first.
+      auto counts_traits = algo::traits(force_cardinal<iterator_cardinal_v<decltype(o)>>, no_aligning, unroll<1>);
+      if( last - o > 1 )
+      {
+        transform_to[counts_traits](views::zip(as_range(o + 1, last), o), o, detail::rle_counts{});
+      }
+
+      out_t last_run = eve::read(last - 1);
+      get<1>(last_run) = n - get<1>(last_run);
+      eve::write(last_run, last - 1);
+
+      return out + (last - o);
+    }
+
+    template <relaxed_range Rng, relaxed_iterator O>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, O out) const
+    {
+      return operator()(EVE_FWD(rng), out, eve::is_equal);
+    }
+
+    template <relaxed_range Rng, relaxed_iterator ValuesO, relaxed_iterator CountsO, typename Eq>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, ValuesO values, CountsO counts, Eq eq) const
+    {
+      auto out = views::zip(values, counts);
+      auto m   = operator()(EVE_FWD(rng), out, eq) - out;
+      return kumi::tuple{values + m, counts + m};
+    }
+
+    template <relaxed_range Rng, relaxed_iterator ValuesO, relaxed_iterator CountsO>
+    EVE_FORCEINLINE auto operator()(Rng&& rng, ValuesO values, CountsO counts) const
+    {
+      return operator()(EVE_FWD(rng), values, counts, eve::is_equal);
+    }
+  };
+
+  //================================================================================================
+  //! @addtogroup algos
+  //! @{
+  //!  @var run_length_encode
+  //!  @brief Writes a (value, count) pair for every group of consecutive equal elements
+  //!
+  //!  The first elements of the groups are found the same way as eve::algo::unique, and
+  //!  compacted together with their positions. The positions are then turned into counts.
+  //!
+  //!  @note
+  //!         * Only the elements written are touched in the outputs.
+  //!         * The count type has to be able to hold the size of the range.
+  //!
+  //!   **Alternative Header**
+  //!
+  //!   @code
+  //!   #include <eve/algo.hpp>
+  //!   @endcode
+  //!
+  //!   @groupheader{Callable Signatures}
+  //!
+  //!   @code
+  //!   namespace eve::algo
+  //!   {
+  //!     template <relaxed_range Rng, relaxed_iterator O, typename Eq>
+  //!     O run_length_encode(Rng&& rng, O out, Eq eq = eve::is_equal);                     // 1
+  //!
+  //!     template <relaxed_range Rng, relaxed_iterator ValuesO, relaxed_iterator CountsO, typename Eq>
+  //!     kumi::tuple<ValuesO, CountsO>
+  //!     run_length_encode(Rng&& rng, ValuesO values, CountsO counts, Eq eq = eve::is_equal); // 2
+  //!   }
+  //!   @endcode
+  //!
+  //!   1. Writes `kumi::tuple{value, count}` to `out`
+  //!      (for example the iterator of a `soa_vector<kumi::tuple<T, std::uint32_t>>`).
+  //!   2. Writes the values to `values` and the counts to `counts`.
+  //!
+  //!   **Parameters**
+  //!
+  //!    * `rng`: Relaxed input range to process
+  //!    * `out`, `values`, `counts`: Relaxed iterators to the beginning of the destinations
+  //!    * `eq`: Equality taking two wides and returning a logical
+  //!
+  //!   **Return value**
+  //!
+  //!   Iterator(s) past the last element written.
+  //!
+  //!   @groupheader{Example}
+  //!
+  //!   @godbolt{doc/algo/unique.cpp}
+  //! @}
+  //================================================================================================
+  inline constexpr auto run_length_encode = function_with_traits<run_length_encode_>[default_simple_algo_traits];
+}
@@ -7,6 +7,7 @@
 //==================================================================================================
 #pragma once
 
+#include <eve/module/core/constant/as_value.hpp>
 #include <eve/module/core/constant/zero.hpp>
 #include <eve/module/core/regular/plus.hpp>
 #include <eve/module/core/regular/slide_right.hpp>
@@ -58,7 +59,7 @@ scan_(EVE_SUPPORTS(cpu_), Wide v, Op op, Zero z) noexcept
   {
     return scan_common_impl<Wide::size()>(v, op);
   }
-  else { return scan_common_impl<Wide::size()>(v, op, Wide {z}); }
+  else { return scan_common_impl<Wide::size()>(v, op, as_value(z, as<Wide> {})); }
 }
 
 template<simd_value Wide>
@@ -0,0 +1,28 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<int>    v = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+  std::vector<int>    odds(v.size());
+  std::vector<double> halves(v.size());
+
+  std::cout << " -> v                                                       = ";
+  doc_utils::print(v);
+
+  odds.erase(eve::algo::copy_if(v, odds.begin(), eve::is_odd), odds.end());
+
+  std::cout << " <- odds after copy_if(v, odds, is_odd)                     = ";
+  doc_utils::print(odds);
+
+  auto half = [](auto x) { return eve::convert(x, eve::as<double>{}) / 2; };
+  halves.erase(eve::algo::transform_copy_if(v, halves.begin(), eve::is_even, half), halves.end());
+
+  std::cout << " <- halves after transform_copy_if(v, halves, is_even, x/2) = ";
+  doc_utils::print(halves);
+
+  return 0;
+}
@@ -0,0 +1,30 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <bitset>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+int main()
+{
+  std::string_view          text = "id,name,\"note, with comma\"\n1,eve,simd\n";
+  std::vector<std::uint8_t> in(text.begin(), text.end());
+
+  constexpr eve::algo::byte_classifier structural {',', '"', '\n', '\\'};
+
+  std::cout << " -> text                                 = " << "id,name,\"note, with comma\"\\n1,eve,simd\\n" << "\n";
+
+  auto pos = eve::algo::find_first_of(in, structural) - in.begin();
+  std::cout << " <- find_first_of(text, structural)      = " << pos << "\n";
+
+  std::vector<std::uint8_t> quotes = {'"'};
+  pos = eve::algo::find_first_of(in, quotes) - in.begin();
+  std::cout << " <- find_first_of(text, quotes)          = " << pos << "\n";
+
+  std::uint64_t bits;
+  eve::algo::to_bitmask(in, &bits, structural);
+  std::cout << " <- to_bitmask(text, &bits, structural)  = " << std::bitset<64>(bits) << "\n";
+
+  return 0;
+}
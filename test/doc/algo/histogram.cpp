@@ -0,0 +1,32 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<std::uint8_t>  v = {1, 3, 0, 3, 3, 2, 1, 7, 0, 3, 2, 2, 1};
+  std::vector<std::uint32_t> counts(4, 0);
+
+  std::cout << " -> v                                         = ";
+  doc_utils::print(v);
+
+  eve::algo::histogram(v, counts);
+
+  std::cout << " <- counts after histogram(v, counts)         = ";
+  doc_utils::print(counts);
+
+  std::vector<float>         f = {0.1f, 0.7f, 0.35f, 0.9f, 0.55f, 0.05f};
+  std::vector<std::uint32_t> halves(2, 0);
+
+  std::cout << " -> f                                         = ";
+  doc_utils::print(f);
+
+  eve::algo::histogram(f, halves, [](auto x) { return eve::convert(x * 2, eve::as<int>{}); });
+
+  std::cout << " <- halves after histogram(f, halves, x * 2)  = ";
+  doc_utils::print(halves);
+
+  return 0;
+}
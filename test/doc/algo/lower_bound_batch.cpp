@@ -0,0 +1,43 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <eve/views/zip.hpp>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<int> haystack = {1, 3, 3, 5, 8, 13, 21};
+  std::vector<int> needles  = {0, 3, 4, 13, 22, 8};
+  std::vector<std::uint32_t> lo(needles.size()), hi(needles.size());
+
+  std::cout << " -> haystack                                            = ";
+  doc_utils::print(haystack);
+  std::cout << " -> needles                                             = ";
+  doc_utils::print(needles);
+
+  eve::algo::lower_bound_batch(haystack, needles, lo);
+  eve::algo::upper_bound_batch(haystack, needles, hi);
+
+  std::cout << " <- lower_bound_batch(haystack, needles, lo)            = ";
+  doc_utils::print(lo);
+  std::cout << " <- upper_bound_batch(haystack, needles, hi)            = ";
+  doc_utils::print(hi);
+
+  // Eytzinger layout: positions are in the new layout, carry a payload to map them back.
+  std::vector<int> positions = {0, 1, 2, 3, 4, 5, 6};
+  std::vector<int> eyt(haystack.size()), eyt_positions(haystack.size());
+  eve::algo::eytzinger_layout(eve::views::zip(haystack, positions), eve::views::zip(eyt, eyt_positions));
+
+  std::cout << " <- eyt after eytzinger_layout                          = ";
+  doc_utils::print(eyt);
+
+  std::vector<std::uint32_t> found(needles.size());
+  eve::algo::eytzinger_lower_bound_batch(eyt, needles, found);
+
+  std::cout << " <- eytzinger_lower_bound_batch(eyt, needles, found)    = ";
+  doc_utils::print(found);
+
+  return 0;
+}
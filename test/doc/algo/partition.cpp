@@ -0,0 +1,34 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<int> v = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+  std::vector<int> odds(v.size()), evens(v.size());
+
+  std::cout << " -> v                                                  = ";
+  doc_utils::print(v);
+
+  auto [odds_end, evens_end] = eve::algo::partition_copy(v, odds.begin(), evens.begin(), eve::is_odd);
+  odds.erase(odds_end, odds.end());
+  evens.erase(evens_end, evens.end());
+
+  std::cout << " <- odds after partition_copy(v, odds, evens, is_odd)  = ";
+  doc_utils::print(odds);
+  std::cout << " <- evens after partition_copy(v, odds, evens, is_odd) = ";
+  doc_utils::print(evens);
+
+  auto point = eve::algo::stable_partition(v, [](auto x) { return x > 6; });
+
+  std::cout << " <- v after stable_partition(v, x > 6)                 = ";
+  doc_utils::print(v);
+  std::cout << " <- returned position                                  = " << (point - v.begin()) << "\n";
+
+  std::cout << " <- partition_point(v, x > 6)                          = "
+            << (eve::algo::partition_point(v, [](auto x) { return x > 6; }) - v.begin()) << "\n";
+
+  return 0;
+}
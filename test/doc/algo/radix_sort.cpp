@@ -0,0 +1,30 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<float> v = {5.5f, -3.f, 12.f, -0.25f, 8.f, 0.f, 7.f, -7.f, 2.f};
+
+  std::cout << " -> v                                             = ";
+  doc_utils::print(v);
+
+  eve::algo::radix_sort(v);
+
+  std::cout << " <- v after radix_sort(v)                         = ";
+  doc_utils::print(v);
+
+  std::vector<int> keys    = {3, 1, 2, 1, 3};
+  std::vector<int> values = {0, 1, 2, 3, 4};
+
+  eve::algo::radix_sort_by_key(keys, values);
+
+  std::cout << " <- keys after radix_sort_by_key(keys, values)   = ";
+  doc_utils::print(keys);
+  std::cout << " <- values after radix_sort_by_key(keys, values) = ";
+  doc_utils::print(values);
+
+  return 0;
+}
@@ -0,0 +1,38 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<int> keys  {1, 1, 1, 2, 2, 3, 3, 3, 3, 4, 5, 5};
+  std::vector<int> values{4, 1, 3, 2, 7, 5, 1, 6, 2, 9, 3, 8};
+  std::vector<int> flags {1, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0};
+  std::vector<int> w(values.size());
+
+  std::cout << " -> keys                                                         = ";
+  doc_utils::print(keys);
+  std::cout << " -> values                                                       = ";
+  doc_utils::print(values);
+
+  std::cout << " <- eve::algo::inclusive_scan_by_key_to(keys, values, w)         = ";
+  eve::algo::inclusive_scan_by_key_to(keys, values, w);
+  doc_utils::print(w);
+
+  std::cout << " <- eve::algo::inclusive_scan_by_key_to(keys, values, w, {max})  = ";
+  eve::algo::inclusive_scan_by_key_to(keys, values, w, std::pair{eve::max, eve::valmin});
+  doc_utils::print(w);
+
+  std::cout << " <- eve::algo::exclusive_scan_to(values, w, 0)                   = ";
+  eve::algo::exclusive_scan_to(values, w, 0);
+  doc_utils::print(w);
+
+  std::cout << " -> flags                                                        = ";
+  doc_utils::print(flags);
+  std::cout << " <- eve::algo::segmented_inclusive_scan_inplace(flags, values)   = ";
+  eve::algo::segmented_inclusive_scan_inplace(flags, values);
+  doc_utils::print(values);
+
+  return 0;
+}
@@ -0,0 +1,24 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+int main()
+{
+  std::string_view text = "2024-05-01 INFO start; 2024-05-01 WARN disk; 2024-05-02 ERROR disk full";
+  std::vector<std::uint8_t> haystack(text.begin(), text.end());
+
+  std::cout << " -> haystack                        = " << text << "\n";
+
+  for( std::string_view word : {"ERROR", "disk", "WARN", "FATAL", ";"} )
+  {
+    std::vector<std::uint8_t> needle(word.begin(), word.end());
+    auto pos = eve::algo::search(haystack, needle) - haystack.begin();
+    std::cout << " <- search(haystack, \"" << word << "\")" << std::string(12 - word.size(), ' ')
+              << "= " << pos << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,32 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<int> a = {1, 2, 3, 5, 8, 13, 21, 34, 55, 89};
+  std::vector<int> b = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+
+  std::cout << " -> a                                = ";
+  doc_utils::print(a);
+  std::cout << " -> b                                = ";
+  doc_utils::print(b);
+
+  std::vector<int> out(a.size() + b.size());
+
+  auto end = eve::algo::set_intersection(a, b, out.begin());
+  std::cout << " <- set_intersection(a, b, out)      = ";
+  doc_utils::print(std::vector<int>(out.begin(), end));
+
+  end = eve::algo::set_union(a, b, out.begin());
+  std::cout << " <- set_union(a, b, out)             = ";
+  doc_utils::print(std::vector<int>(out.begin(), end));
+
+  end = eve::algo::set_difference(a, b, out.begin());
+  std::cout << " <- set_difference(a, b, out)        = ";
+  doc_utils::print(std::vector<int>(out.begin(), end));
+
+  return 0;
+}
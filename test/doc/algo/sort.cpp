@@ -0,0 +1,34 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<int> v = {5, 3, 12, -1, 8, 0, 7, 7, 2, 10, -4, 6, 1};
+
+  std::cout << " -> v                                     = ";
+  doc_utils::print(v);
+
+  std::cout << " <- eve::algo::sort(v)                    = ";
+  eve::algo::sort(v);
+  doc_utils::print(v);
+
+  std::vector<float> keys   = {3.5f, 1.f, 2.25f, 0.5f};
+  std::vector<int>   values = {35, 10, 22, 5};
+
+  std::cout << " -> keys                                  = ";
+  doc_utils::print(keys);
+  std::cout << " -> values                                = ";
+  doc_utils::print(values);
+
+  eve::algo::sort_by_key(keys, values);
+
+  std::cout << " <- keys after sort_by_key(keys, values)  = ";
+  doc_utils::print(keys);
+  std::cout << " <- values after sort_by_key(keys, values)= ";
+  doc_utils::print(values);
+
+  return 0;
+}
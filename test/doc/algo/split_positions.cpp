@@ -0,0 +1,33 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::string_view          text = "id,name,note\n1,eve,\"simd, fast\"\n2,\"say \"\"hi\"\"\",x\n";
+  std::vector<std::uint8_t> in(text.begin(), text.end());
+
+  constexpr eve::algo::byte_classifier separators {',', '\n'};
+
+  std::vector<std::uint32_t> offsets(in.size());
+  auto end = eve::algo::split_positions(in, offsets.begin(), separators);
+  offsets.resize(end - offsets.begin());
+
+  std::cout << " <- split_positions(text, offsets, {',', '\\n'}) = ";
+  doc_utils::print(offsets);
+
+  std::cout << " <- fields                                     = ";
+  std::size_t start = 0;
+  for( auto pos : offsets )
+  {
+    std::cout << '[' << text.substr(start, pos - start) << "] ";
+    start = pos + 1;
+  }
+  std::cout << "\n";
+
+  return 0;
+}
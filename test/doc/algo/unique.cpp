@@ -0,0 +1,32 @@
+#include <eve/module/core.hpp>
+#include <eve/algo.hpp>
+#include <iostream>
+#include <vector>
+#include "print.hpp"
+
+int main()
+{
+  std::vector<int> v = {1, 1, 2, 3, 3, 3, 4, 5, 5, 6, 6, 6, 6};
+
+  std::cout << " -> v                                      = ";
+  doc_utils::print(v);
+
+  std::vector<int>           values(v.size());
+  std::vector<std::uint32_t> counts(v.size());
+
+  auto [values_end, counts_end] = eve::algo::run_length_encode(v, values.begin(), counts.begin());
+  values.erase(values_end, values.end());
+  counts.erase(counts_end, counts.end());
+
+  std::cout << " <- values after run_length_encode(v)      = ";
+  doc_utils::print(values);
+  std::cout << " <- counts after run_length_encode(v)      = ";
+  doc_utils::print(counts);
+
+  v.erase(eve::algo::unique(v), v.end());
+
+  std::cout << " <- v after v.erase(unique(v), v.end())    = ";
+  doc_utils::print(v);
+
+  return 0;
+}
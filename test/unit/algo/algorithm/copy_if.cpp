@@ -0,0 +1,122 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+// g++ 11 regression fires __builtin_memmove spurious warnings
+// https://gcc.gnu.org/bugzilla/show_bug.cgi?id=100516
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/copy_if.hpp>
+
+#include <eve/algo/as_range.hpp>
+#include <eve/views/zip.hpp>
+
+#include <algorithm>
+#include <vector>
+
+TTS_CASE_TPL("Check copy_if", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::copy_if[eve::algo::force_cardinal<T::size()>];
+
+  for( int offset : {0, 1, (int)T::size() - 1} )
+  {
+    for( int size : {0, 1, 2, (int)T::size(), (int)T::size() + 1, 3 * (int)T::size() + 2, 100, 257} )
+    {
+      std::vector<e_t> in(offset + size);
+      for( std::size_t i = 0; i != in.size(); ++i ) in[i] = static_cast<e_t>((i * 7) % 19);
+      std::vector<e_t> const in_copy = in;
+
+      std::vector<e_t> expected;
+      std::copy_if(in.begin() + offset, in.end(), std::back_inserter(expected), [](e_t x) { return x > 5; });
+
+      // exactly the size needed: writing past the end is caught by sanitizers
+      std::vector<e_t> out(expected.size());
+      auto end = alg(eve::algo::as_range(in.data() + offset, in.data() + in.size()), out.data(),
+                     [](auto x) { return x > 5; });
+
+      TTS_EQUAL(end - out.data(), (std::ptrdiff_t)expected.size());
+      TTS_EQUAL(out, expected);
+      TTS_EQUAL(in, in_copy);
+    }
+  }
+};
+
+TTS_CASE_TPL("Check transform_copy_if", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::vector<e_t> in(200);
+  for( std::size_t i = 0; i != in.size(); ++i ) in[i] = static_cast<e_t>(i % 50);
+
+  std::vector<double> expected;
+  for( e_t x : in )
+    if( x < 20 ) expected.push_back(double(x) + 1);
+
+  // different output type
+  std::vector<double> out(expected.size());
+  auto end = eve::algo::transform_copy_if[eve::algo::force_cardinal<T::size()>](
+      in, out.begin(), [](auto x) { return x < 20; },
+      [](auto x) { return eve::convert(x, eve::as<double>{}) + 1; });
+
+  TTS_EQUAL(end - out.begin(), (std::ptrdiff_t)expected.size());
+  TTS_EQUAL(out, expected);
+};
+
+TTS_CASE("Check copy_if conversion")
+{
+  std::vector<std::int8_t> in(100);
+  for( int i = 0; i != 100; ++i ) in[i] = static_cast<std::int8_t>(i - 50);
+
+  std::vector<std::int64_t> out(50, -1000);
+  auto end = eve::algo::copy_if(in, out.begin(), [](auto x) { return x >= 0; });
+
+  TTS_EQUAL(end - out.begin(), 50);
+  for( int i = 0; i != 50; ++i ) TTS_EQUAL(out[i], i);
+};
+
+TTS_CASE("Check copy_if zip")
+{
+  std::vector<int>    ids(300);
+  std::vector<float>  prices(300);
+  std::vector<short>  quantities(300);
+  for( int i = 0; i != 300; ++i )
+  {
+    ids[i]        = i;
+    prices[i]     = (i % 10) * 1.5f;
+    quantities[i] = static_cast<short>(i % 7);
+  }
+
+  std::vector<int>   out_ids(300, -1);
+  std::vector<float> out_prices(300, -1);
+  std::vector<short> out_quantities(300, -1);
+
+  auto end = eve::algo::copy_if(eve::views::zip(ids, prices, quantities),
+                                eve::views::zip(out_ids.begin(), out_prices.begin(), out_quantities.begin()),
+                                [](auto row) { return get<1>(row) > 6 && get<2>(row) != 0; });
+
+  std::ptrdiff_t expected_size = 0;
+  for( int i = 0; i != 300; ++i )
+  {
+    if( !(prices[i] > 6 && quantities[i] != 0) ) continue;
+    TTS_EQUAL(out_ids[expected_size], ids[i]);
+    TTS_EQUAL(out_prices[expected_size], prices[i]);
+    TTS_EQUAL(out_quantities[expected_size], quantities[i]);
+    ++expected_size;
+  }
+
+  TTS_EQUAL(get<0>(end) - out_ids.begin(), expected_size);
+  TTS_EQUAL(out_ids[expected_size], -1);
+};
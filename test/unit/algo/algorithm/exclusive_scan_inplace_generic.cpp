@@ -0,0 +1,70 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/exclusive_scan.hpp>
+
+#include "transform_inplace_generic_test.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TTS_CASE_TPL("Check exclusive_scan_inplace", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  algo_test::transform_inplace_generic_test(
+    eve::as<T>{},
+    eve::algo::exclusive_scan_inplace,
+    [](auto f, auto l, auto o, auto init) {
+      std::exclusive_scan(f, l, o, init, std::plus<>{});
+    },
+    eve::element_type_t<T>{10}
+  );
+};
+
+TTS_CASE_TPL("Check scans with other operations", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937                       g(3);
+  std::uniform_int_distribution<int> dist(0, 100);
+
+  for( int size : {0, 1, 3, 17, 64, 131} )
+  {
+    std::vector<e_t> v(size);
+    for( auto& x : v ) x = static_cast<e_t>(dist(g));
+
+    auto check = [&](auto op_zero, auto std_op, e_t init)
+    {
+      std::vector<e_t> expected(size), actual(size);
+
+      std::exclusive_scan(v.begin(), v.end(), expected.begin(), init, std_op);
+      eve::algo::exclusive_scan_to(v, actual, op_zero, init);
+      TTS_EQUAL(actual, expected);
+
+      std::inclusive_scan(v.begin(), v.end(), expected.begin(), std_op, init);
+      eve::algo::inclusive_scan_to(v, actual, op_zero, init);
+      TTS_EQUAL(actual, expected);
+    };
+
+    auto max = [](e_t a, e_t b) { return std::max(a, b); };
+    auto min = [](e_t a, e_t b) { return std::min(a, b); };
+
+    check(std::pair{eve::max, eve::valmin}, max, eve::valmin(eve::as<e_t>{}));
+    check(std::pair{eve::min, eve::valmax}, min, eve::valmax(eve::as<e_t>{}));
+
+    if constexpr( std::integral<e_t> )
+    {
+      check(std::pair{eve::bit_or, eve::zero}, std::bit_or<>{}, e_t{0});
+    }
+  }
+};
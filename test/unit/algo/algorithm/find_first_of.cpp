@@ -0,0 +1,121 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/find_first_of.hpp>
+#include <eve/algo/to_bitmask.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TTS_CASE("Check byte_classifier, every byte")
+{
+  std::mt19937 g(5);
+
+  for( int attempt = 0; attempt != 50; ++attempt )
+  {
+    std::vector<std::uint8_t> set(attempt % 20);
+    for( auto& b : set ) b = static_cast<std::uint8_t>(g());
+
+    eve::algo::byte_classifier c;
+    for( auto b : set ) c.add(b);
+
+    std::vector<std::uint8_t> all(256);
+    for( int b = 0; b != 256; ++b ) all[b] = static_cast<std::uint8_t>(b);
+
+    auto expected = [&](std::uint8_t b) { return std::find(set.begin(), set.end(), b) != set.end(); };
+
+    for( int b = 0; b != 256; ++b ) TTS_EQUAL(c.contains(b), expected(b));
+
+    auto check = [&]<typename N>(N)
+    {
+      for( int b = 0; b != 256; b += N::value )
+      {
+        eve::wide<std::uint8_t, N> x(all.data() + b);
+        auto                       res = c(x);
+        for( int i = 0; i != N::value; ++i ) TTS_EQUAL(res.get(i), expected(b + i));
+      }
+    };
+    check(eve::fixed<4> {});
+    check(eve::fixed<16> {});
+    check(eve::fixed<32> {});
+    check(eve::fixed<64> {});
+  }
+};
+
+TTS_CASE_TPL("Check find_first_of", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::find_first_of[eve::algo::force_cardinal<T::size()>];
+
+  std::mt19937 g(11);
+
+  for( int size : {0, 1, 2, (int)T::size(), 3 * (int)T::size() + 1, 100} )
+  {
+    std::vector<e_t> in(size);
+    for( auto& x : in ) x = static_cast<e_t>(g() % 50);
+
+    for( int m : {0, 1, 3, 7} )
+    {
+      std::vector<e_t> values(m);
+      for( auto& x : values ) x = static_cast<e_t>(g() % 50);
+
+      auto expected = std::find_first_of(in.begin(), in.end(), values.begin(), values.end());
+      TTS_EQUAL(alg(in, values) - in.begin(), expected - in.begin());
+    }
+  }
+};
+
+TTS_CASE_TPL("Check to_bitmask", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::to_bitmask[eve::algo::force_cardinal<T::size()>];
+
+  for( int size : {0, 1, 2, (int)T::size(), 63, 64, 65, 127, 128, 200} )
+  {
+    std::vector<e_t> in(size);
+    for( int i = 0; i != size; ++i ) in[i] = static_cast<e_t>((i * 7) % 11);
+
+    std::vector<std::uint64_t> expected((size + 63) / 64, 0);
+    for( int i = 0; i != size; ++i )
+    {
+      if( in[i] > 5 ) expected[i / 64] |= std::uint64_t {1} << (i % 64);
+    }
+
+    std::vector<std::uint64_t> out(expected.size(), 0xdead);
+    auto end = alg(in, out.begin(), [](auto x) { return x > 5; });
+
+    TTS_EXPECT(end == out.end());
+    TTS_EQUAL(out, expected);
+  }
+};
+
+TTS_CASE("Check to_bitmask with a byte_classifier")
+{
+  constexpr eve::algo::byte_classifier structural {',', '"', '\n', '\\'};
+
+  std::string_view text = "a,b,\"c\\\"d\"\nee,f\n";
+  std::vector<std::uint8_t> in(text.begin(), text.end());
+
+  std::uint64_t expected = 0;
+  for( std::size_t i = 0; i != text.size(); ++i )
+  {
+    if( structural.contains(text[i]) ) expected |= std::uint64_t {1} << i;
+  }
+
+  std::uint64_t word;
+  eve::algo::to_bitmask(in, &word, structural);
+  TTS_EQUAL(word, expected);
+
+  TTS_EQUAL(eve::algo::find_first_of(in, structural) - in.begin(), 1);
+};
@@ -0,0 +1,108 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/histogram.hpp>
+
+#include <eve/algo/as_range.hpp>
+
+#include <random>
+#include <vector>
+
+TTS_CASE_TPL("Check histogram", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::histogram[eve::algo::force_cardinal<T::size()>];
+
+  std::mt19937 g(5);
+  std::uniform_int_distribution<int> d(0, 40);
+
+  for( int offset : {0, 1, (int)T::size() - 1} )
+  {
+    for( int size : {0, 1, 2, (int)T::size(), (int)T::size() + 1, 100, 1000} )
+    {
+      std::vector<e_t> v(offset + size);
+      for( auto& x : v ) x = static_cast<e_t>(d(g));
+
+      // 10 buckets of width 4, values >= 40 are dropped
+      std::vector<std::uint32_t> expected(10, 1), bins(10, 1);
+      for( int i = offset; i != (int)v.size(); ++i )
+      {
+        int b = static_cast<int>(v[i]) / 4;
+        if( b < 10 ) ++expected[b];
+      }
+
+      alg(eve::algo::as_range(v.data() + offset, v.data() + v.size()), bins,
+          [](auto x) { return eve::convert(x / 4, eve::as<std::int32_t>{}); });
+      TTS_EQUAL(bins, expected);
+    }
+  }
+};
+
+TTS_CASE_TPL("Check histogram count by key", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  if constexpr( std::integral<e_t> )
+  {
+    std::vector<e_t> v(777);
+    for( std::size_t i = 0; i != v.size(); ++i ) v[i] = static_cast<e_t>((i * 13) % 20) - 2;
+
+    std::vector<std::uint64_t> expected(16, 0), bins(16, 0);
+    for( e_t x : v )
+      if( x >= 0 && x < 16 ) ++expected[x];
+
+    eve::algo::histogram(v, bins);
+    TTS_EQUAL(bins, expected);
+  }
+  else TTS_PASS("Count by key needs integral keys");
+};
+
+TTS_CASE("Check histogram 8 and 16 bits keys")
+{
+  std::mt19937 g(7);
+
+  std::vector<std::uint8_t> bytes(10000);
+  for( auto& x : bytes ) x = static_cast<std::uint8_t>(g());
+
+  std::vector<std::uint32_t> expected_bytes(256, 0), bins_bytes(256, 0);
+  for( auto x : bytes ) ++expected_bytes[x];
+  eve::algo::histogram(bytes, bins_bytes);
+  TTS_EQUAL(bins_bytes, expected_bytes);
+
+  std::vector<std::uint16_t> shorts(100000);
+  for( auto& x : shorts ) x = static_cast<std::uint16_t>(g());
+
+  std::vector<std::uint32_t> expected_shorts(65536, 0), bins_shorts(65536, 0);
+  for( auto x : shorts ) ++expected_shorts[x];
+  eve::algo::histogram(shorts, bins_shorts);
+  TTS_EQUAL(bins_shorts, expected_shorts);
+};
+
+TTS_CASE("Check histogram float buckets")
+{
+  std::vector<float> v(1000);
+  for( int i = 0; i != 1000; ++i ) v[i] = (i % 100) * 0.1f - 2.f;  // [-2, 7.9]
+
+  // [0, 1), [1, 2), ... [4, 5), the rest is dropped
+  auto bucket = [](auto x) { return eve::convert(eve::floor(x), eve::as<std::int32_t>{}); };
+
+  std::vector<int> expected(5, 0), bins(5, 0);
+  for( float x : v )
+  {
+    int b = static_cast<int>(std::floor(x));
+    if( b >= 0 && b < 5 ) ++expected[b];
+  }
+
+  eve::algo::histogram(v, bins, bucket);
+  TTS_EQUAL(bins, expected);
+};
@@ -0,0 +1,99 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/lower_bound_batch.hpp>
+
+#include <eve/algo/as_range.hpp>
+#include <eve/views/zip.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TTS_CASE_TPL("Check lower_bound_batch/upper_bound_batch", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937 g(19);
+
+  auto lower = eve::algo::lower_bound_batch[eve::algo::force_cardinal<T::size()>];
+  auto upper = eve::algo::upper_bound_batch[eve::algo::force_cardinal<T::size()>];
+
+  for( int size : {0, 1, 2, 3, 7, 8, 9, 100, 120} )
+  {
+    std::vector<e_t> haystack(size);
+    for( int i = 0; i != size; ++i ) haystack[i] = static_cast<e_t>((i / 2) * 2);  // duplicates and holes
+
+    std::vector<e_t> needles(3 * T::size() + 1);
+    for( auto& x : needles ) x = static_cast<e_t>(g() % (size + 3));
+
+    std::vector<std::int32_t> lo(needles.size()), hi(needles.size());
+    lower(haystack, needles, lo);
+    upper(haystack, needles, hi.begin());
+
+    for( std::size_t i = 0; i != needles.size(); ++i )
+    {
+      TTS_EQUAL(lo[i], std::lower_bound(haystack.begin(), haystack.end(), needles[i]) - haystack.begin());
+      TTS_EQUAL(hi[i], std::upper_bound(haystack.begin(), haystack.end(), needles[i]) - haystack.begin());
+    }
+  }
+};
+
+TTS_CASE("Check lower_bound_batch custom comparison and index type")
+{
+  std::vector<double> haystack {10., 8., 6., 4., 2.};
+  std::vector<double> needles {11., 10., 9., 2., 1., 5.};
+  std::vector<std::uint64_t> out(needles.size());
+
+  eve::algo::lower_bound_batch(haystack, needles, out, eve::is_greater);
+  TTS_EQUAL(out, (std::vector<std::uint64_t> {0, 0, 1, 4, 5, 3}));
+};
+
+TTS_CASE_TPL("Check eytzinger", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937 g(23);
+
+  for( int size : {0, 1, 2, 3, 6, 7, 8, 9, 60} )  // 2 * size + 3 fits in 8 bits
+  {
+    std::vector<e_t> sorted(size), payload(size);
+    for( int i = 0; i != size; ++i )
+    {
+      sorted[i]  = static_cast<e_t>(2 * i);
+      payload[i] = static_cast<e_t>(i);
+    }
+
+    std::vector<e_t> eyt(size), eyt_payload(size);
+    eve::algo::eytzinger_layout(eve::views::zip(sorted, payload), eve::views::zip(eyt, eyt_payload));
+
+    // heap property of a search tree
+    for( int k = 0; k != size; ++k )
+    {
+      if( 2 * k + 1 < size ) TTS_EXPECT(eyt[2 * k + 1] < eyt[k]);
+      if( 2 * k + 2 < size ) TTS_EXPECT(eyt[k] < eyt[2 * k + 2]);
+    }
+
+    std::vector<e_t> needles(2 * T::size() + 3);
+    for( auto& x : needles ) x = static_cast<e_t>(g() % (2 * size + 3));
+
+    std::vector<std::int32_t> found(needles.size());
+    eve::algo::eytzinger_lower_bound_batch[eve::algo::force_cardinal<T::size()>](eyt, needles, found);
+
+    for( std::size_t i = 0; i != needles.size(); ++i )
+    {
+      auto expected = std::lower_bound(sorted.begin(), sorted.end(), needles[i]) - sorted.begin();
+      if( expected == size ) TTS_EQUAL(found[i], size);
+      else TTS_EQUAL(eyt_payload[found[i]], payload[expected]);
+    }
+  }
+};
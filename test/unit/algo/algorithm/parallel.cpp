@@ -0,0 +1,180 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo.hpp>
+#include <eve/algo/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+  eve::algo::thread_pool& test_pool()
+  {
+    static eve::algo::thread_pool pool(4);
+    return pool;
+  }
+
+  auto par()
+  {
+    return eve::algo::traits(eve::algo::parallel,
+                             eve::algo::parallel_job_size<40>,
+                             eve::algo::thread_pool_key = &test_pool());
+  }
+
+  // Sizes and offsets so that subranges start unaligned, aligned and are smaller than a job.
+  template <typename Test> void for_sizes_and_offsets(Test test)
+  {
+    for( int offset : {0, 1, 3} )
+    {
+      for( int size : {0, 1, 7, 39, 40, 41, 100, 257, 1000, 4097} ) test(offset, size);
+    }
+  }
+}
+
+TTS_CASE("eve.algo.thread_pool runs every task once")
+{
+  std::vector<std::atomic<int>> hits(1000);
+  test_pool().run(hits.size(), [&](std::size_t i) { ++hits[i]; });
+  TTS_EXPECT(std::all_of(hits.begin(), hits.end(), [](auto const& x) { return x == 1; }));
+
+  // nested runs are executed inline
+  std::atomic<int> total = 0;
+  test_pool().run(8, [&](std::size_t) { test_pool().run(8, [&](std::size_t) { ++total; }); });
+  TTS_EQUAL(total.load(), 64);
+
+  TTS_EQUAL(test_pool().concurrency(), 4u);
+  TTS_EXPECT(eve::algo::global_thread_pool().concurrency() >= 1u);
+};
+
+TTS_CASE("eve.algo.parallel for_each based algorithms")
+{
+  for_sizes_and_offsets([](int offset, int size) {
+    std::vector<int> in(offset + size);
+    std::iota(in.begin(), in.end(), 0);
+    std::vector<int> out(in.size(), -1), expected(in.size(), -1);
+
+    auto rin  = eve::algo::as_range(in.data() + offset, in.data() + in.size());
+    auto rout = out.data() + offset;
+
+    eve::algo::transform_to[par()](rin, rout, [](auto x) { return x * 2; });
+    std::transform(in.begin() + offset, in.end(), expected.begin() + offset, [](int x) { return x * 2; });
+    TTS_EQUAL(out, expected);
+
+    eve::algo::copy[par()](rin, rout);
+    std::copy(in.begin() + offset, in.end(), expected.begin() + offset);
+    TTS_EQUAL(out, expected);
+
+    eve::algo::fill[par()](eve::algo::as_range(rout, out.data() + out.size()), 5);
+    std::fill(expected.begin() + offset, expected.end(), 5);
+    TTS_EQUAL(out, expected);
+  });
+};
+
+TTS_CASE("eve.algo.parallel reductions")
+{
+  for_sizes_and_offsets([](int offset, int size) {
+    std::vector<std::int64_t> v(offset + size);
+    std::iota(v.begin(), v.end(), 0);
+    auto r = eve::algo::as_range(v.data() + offset, v.data() + v.size());
+
+    auto expected = std::reduce(v.begin() + offset, v.end(), std::int64_t{3});
+    TTS_EQUAL(eve::algo::reduce[par()](r, std::int64_t{3}), expected);
+
+    auto expected_sqr = std::transform_reduce(v.begin() + offset, v.end(), std::int64_t{3}, std::plus<>{},
+                                              [](auto x) { return x * x; });
+    TTS_EQUAL(eve::algo::transform_reduce[par()](r, [](auto x) { return x * x; }, std::int64_t{3}),
+              expected_sqr);
+
+    if( size )
+    {
+      TTS_EQUAL(*eve::algo::max_value[par()](r), v.back());
+      TTS_EQUAL(*eve::algo::min_value[par()](r), v[offset]);
+    }
+  });
+};
+
+TTS_CASE("eve.algo.parallel find_if")
+{
+  for_sizes_and_offsets([](int offset, int size) {
+    std::vector<short> v(offset + size, 0);
+    auto r = eve::algo::as_range(v.data() + offset, v.data() + v.size());
+
+    TTS_EQUAL(eve::algo::find[par()](r, short{1}), r.end());
+
+    for( int pos : {0, 1, size / 2, size - 1} )
+    {
+      if( pos < 0 || pos >= size ) continue;
+      v[offset + pos] = 1;
+      v.back() = 1;
+      TTS_EQUAL(eve::algo::find[par()](r, short{1}) - r.begin(), pos);
+      v[offset + pos] = 0;
+      v.back() = 0;
+    }
+  });
+};
+
+TTS_CASE("eve.algo.parallel inclusive_scan")
+{
+  for_sizes_and_offsets([](int offset, int size) {
+    std::vector<int> v(offset + size);
+    std::iota(v.begin(), v.end(), 0);
+
+    std::vector<int> expected = v;
+    std::inclusive_scan(v.begin() + offset, v.end(), expected.begin() + offset, std::plus<>{}, 5);
+
+    std::vector<int> out(v.size(), 0);
+    std::copy(v.begin(), v.begin() + offset, out.begin());
+    eve::algo::inclusive_scan_to[par()](eve::algo::as_range(v.data() + offset, v.data() + v.size()),
+                                        out.data() + offset, 5);
+    TTS_EQUAL(out, expected);
+
+    eve::algo::inclusive_scan_inplace[par()](eve::algo::as_range(v.data() + offset, v.data() + v.size()), 5);
+    TTS_EQUAL(v, expected);
+  });
+};
+
+TTS_CASE("eve.algo.parallel remove_if")
+{
+  for_sizes_and_offsets([](int offset, int size) {
+    std::vector<int> v(offset + size);
+    std::iota(v.begin(), v.end(), 0);
+    std::vector<int> expected = v;
+
+    auto p = [](auto x) { return (x % 3) == 0 || (x % 7) == 1; };
+
+    auto expected_end = std::remove_if(expected.begin() + offset, expected.end(), [&](int x) { return p(x); });
+    expected.erase(expected_end, expected.end());
+
+    auto end = eve::algo::remove_if[par()](eve::algo::as_range(v.data() + offset, v.data() + v.size()), p);
+    v.erase(v.begin() + (end - v.data()), v.end());
+    TTS_EQUAL(v, expected);
+  });
+};
+
+TTS_CASE("eve.algo.parallel zip and traits")
+{
+  std::vector<int>   a(1000), b(1000);
+  std::vector<float> c(1000);
+  std::iota(a.begin(), a.end(), 0);
+  std::iota(b.begin(), b.end(), 1000);
+
+  eve::algo::transform_to[par()][eve::algo::unroll<1>](
+    eve::views::zip(a, b), c, [](auto ab) { return eve::convert(get<0>(ab) + get<1>(ab), eve::as<float>{}); });
+
+  std::vector<float> expected(1000);
+  for( int i = 0; i != 1000; ++i ) expected[i] = float(a[i] + b[i]);
+  TTS_EQUAL(c, expected);
+
+  TTS_EQUAL(eve::algo::reduce[par()][eve::algo::no_aligning](a, 0), 999 * 1000 / 2);
+  TTS_EQUAL(eve::algo::reduce[par()][eve::algo::parallel_job_size<1>](a, 0), 999 * 1000 / 2);
+};
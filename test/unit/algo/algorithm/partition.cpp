@@ -0,0 +1,153 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+// g++ 11 regression fires __builtin_memmove spurious warnings
+// https://gcc.gnu.org/bugzilla/show_bug.cgi?id=100516
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/partition.hpp>
+
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/container/soa_vector.hpp>
+#include <eve/views/zip.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  // Sizes and offsets to cover aligned/unaligned starts and tails
+  template <typename Test> void for_sizes_and_offsets(int card, Test test)
+  {
+    for( int offset : {0, 1, card - 1} )
+    {
+      for( int size : {0, 1, card - 1, card, card + 1, 3 * card + 2, 100, 257} ) test(offset, size);
+    }
+  }
+}
+
+TTS_CASE_TPL("Check partition_copy", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::partition_copy[eve::algo::force_cardinal<T::size()>];
+
+  for_sizes_and_offsets(T::size(), [&](int offset, int size) {
+    std::vector<e_t> in(offset + size);
+    for( std::size_t i = 0; i != in.size(); ++i ) in[i] = static_cast<e_t>((i * 7) % 19);
+
+    auto p = [](auto x) { return x < 9; };
+
+    std::vector<e_t> expected_true, expected_false;
+    std::partition_copy(in.begin() + offset, in.end(), std::back_inserter(expected_true),
+                        std::back_inserter(expected_false), [&](e_t x) { return x < 9; });
+
+    // outputs exactly of the size needed, so writing past the end is caught by sanitizers
+    std::vector<e_t> out_true(expected_true.size()), out_false(expected_false.size());
+
+    auto [true_end, false_end] =
+        alg(eve::algo::as_range(in.data() + offset, in.data() + in.size()), out_true.data(), out_false.data(), p);
+
+    TTS_EQUAL(true_end - out_true.data(), (std::ptrdiff_t)expected_true.size());
+    TTS_EQUAL(false_end - out_false.data(), (std::ptrdiff_t)expected_false.size());
+    TTS_EQUAL(out_true, expected_true);
+    TTS_EQUAL(out_false, expected_false);
+  });
+};
+
+TTS_CASE_TPL("Check stable_partition", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::stable_partition[eve::algo::force_cardinal<T::size()>];
+
+  for_sizes_and_offsets(T::size(), [&](int offset, int size) {
+    std::vector<e_t> v(offset + size);
+    for( std::size_t i = 0; i != v.size(); ++i ) v[i] = static_cast<e_t>((i * 5) % 23);
+
+    std::vector<e_t> expected = v;
+    auto expected_point = std::stable_partition(expected.begin() + offset, expected.end(),
+                                                [](e_t x) { return x < 8; });
+
+    auto p     = [](auto x) { return x < 8; };
+    auto point = alg(eve::algo::as_range(v.data() + offset, v.data() + v.size()), p);
+
+    TTS_EQUAL(point - v.data(), expected_point - expected.begin());
+    TTS_EQUAL(v, expected);
+
+    // partition_point on the result
+    auto pp = eve::algo::partition_point[eve::algo::force_cardinal<T::size()>](
+        eve::algo::as_range(v.data() + offset, v.data() + v.size()), p);
+    TTS_EQUAL(pp - v.data(), expected_point - expected.begin());
+  });
+};
+
+TTS_CASE_TPL("Check partition_point", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  constexpr int card = T::size();
+
+  for( int size : {0, 1, 2, card - 1, card, card + 1, 4 * card + 3, 120} )
+  {
+    std::vector<e_t> v(size);
+    for( int point = 0; point <= size; ++point )
+    {
+      std::fill(v.begin(), v.begin() + point, e_t{1});
+      std::fill(v.begin() + point, v.end(), e_t{2});
+
+      auto res = eve::algo::partition_point[eve::algo::force_cardinal<T::size()>](
+          v, [](auto x) { return x == 1; });
+      TTS_EQUAL(res - v.begin(), point);
+    }
+  }
+};
+
+TTS_CASE("Check partition zip")
+{
+  std::vector<int>   keys(100);
+  std::vector<float> values(100);
+  for( int i = 0; i != 100; ++i )
+  {
+    keys[i]   = i;
+    values[i] = i * 0.5f;
+  }
+
+  using tuple_t = kumi::tuple<int, float>;
+  eve::algo::soa_vector<tuple_t> hot(50), cold(50);
+
+  auto is_hot = [](auto kv) { return get<0>(kv) % 2 == 0; };
+
+  auto [hot_end, cold_end] = eve::algo::partition_copy(eve::views::zip(keys, values), hot.begin(), cold.begin(), is_hot);
+  TTS_EQUAL(hot_end - hot.begin(), 50);
+  TTS_EQUAL(cold_end - cold.begin(), 50);
+
+  for( int i = 0; i != 50; ++i )
+  {
+    TTS_EQUAL(hot.get(i), (tuple_t {2 * i, i * 1.f}));
+    TTS_EQUAL(cold.get(i), (tuple_t {2 * i + 1, i * 1.f + 0.5f}));
+  }
+
+  auto point = eve::algo::stable_partition(eve::views::zip(keys, values), is_hot);
+  TTS_EQUAL(point - eve::views::zip(keys, values).begin(), 50);
+  for( int i = 0; i != 50; ++i )
+  {
+    TTS_EQUAL(keys[i], 2 * i);
+    TTS_EQUAL(values[i], i * 1.f);
+    TTS_EQUAL(keys[50 + i], 2 * i + 1);
+    TTS_EQUAL(values[50 + i], i * 1.f + 0.5f);
+  }
+};
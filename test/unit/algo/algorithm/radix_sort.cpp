@@ -0,0 +1,130 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/container/soa_vector.hpp>
+#include <eve/algo/radix_sort.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TTS_CASE_TPL("Check radix_sort", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937 g(11);
+
+  auto alg = eve::algo::radix_sort[eve::algo::force_cardinal<T::size()>];
+
+  for( int size : {0, 1, 2, 3, 16, 100, 1000, 4099} )
+  {
+    for( int offset : {0, 1} )
+    {
+      std::vector<e_t> v(size + offset);
+      for( auto& x : v )
+      {
+        if constexpr( std::floating_point<e_t> ) x = static_cast<e_t>(std::uniform_real_distribution<double>(-1e6, 1e6)(g));
+        else x = static_cast<e_t>(g());
+      }
+      std::vector<e_t> expected = v;
+      std::sort(expected.begin() + offset, expected.end());
+
+      alg(eve::algo::as_range(v.data() + offset, v.data() + v.size()));
+      TTS_EQUAL(v, expected);
+    }
+  }
+
+  // extremes, and values that only differ in some of the bytes
+  std::vector<e_t> v;
+  for( int i = 0; i != 50; ++i )
+  {
+    v.push_back(eve::valmax(eve::as<e_t>{}));
+    v.push_back(eve::valmin(eve::as<e_t>{}));
+    v.push_back(static_cast<e_t>(i % 7));
+    v.push_back(static_cast<e_t>(0));
+  }
+  std::shuffle(v.begin(), v.end(), g);
+  std::vector<e_t> expected = v;
+  std::sort(expected.begin(), expected.end());
+  alg(v);
+  TTS_EQUAL(v, expected);
+};
+
+TTS_CASE("Check radix_sort floating point special values")
+{
+  std::vector<double> v {3., eve::inf(eve::as<double>{}), -0.5, eve::minf(eve::as<double>{}), 1.,
+                         eve::valmax(eve::as<double>{}), eve::smallestposval(eve::as<double>{}),
+                         -eve::smallestposval(eve::as<double>{}), -5., 2., 0.};
+  std::vector<double> expected = v;
+  std::sort(expected.begin(), expected.end());
+  eve::algo::radix_sort(v);
+  TTS_EQUAL(v, expected);
+
+  std::vector<float> z {0.f, -0.f, 1.f, -0.f, 0.f};
+  eve::algo::radix_sort(z);
+  TTS_EXPECT(std::signbit(z[0]));
+  TTS_EXPECT(std::signbit(z[1]));
+  TTS_EXPECT(!std::signbit(z[2]));
+  TTS_EXPECT(!std::signbit(z[3]));
+  TTS_EQUAL(z[4], 1.f);
+};
+
+TTS_CASE_TPL("Check radix_sort_by_key", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937 g(13);
+
+  for( int size : {0, 1, 7, 64, 65, 300, 1025} )
+  {
+    std::vector<e_t> keys(size);
+    std::vector<int> values(size);
+    for( int i = 0; i != size; ++i )
+    {
+      keys[i]   = static_cast<e_t>(g() % 20);
+      values[i] = i;
+    }
+
+    std::vector<std::pair<e_t, int>> expected;
+    for( int i = 0; i != size; ++i ) expected.emplace_back(keys[i], values[i]);
+    std::stable_sort(expected.begin(), expected.end(), [](auto a, auto b) { return a.first < b.first; });
+
+    eve::algo::radix_sort_by_key(keys, values);
+
+    // the sort is stable
+    for( int i = 0; i != size; ++i )
+    {
+      TTS_EQUAL(keys[i], expected[i].first);
+      TTS_EQUAL(values[i], expected[i].second);
+    }
+  }
+};
+
+TTS_CASE("Check radix_sort_by_key soa_vector")
+{
+  using row = kumi::tuple<float, std::uint8_t, double>;
+  eve::algo::soa_vector<row> v;
+  for( int i = 0; i != 500; ++i )
+  {
+    float k = static_cast<float>((i * 37) % 500) - 250.f;
+    v.push_back(row {k, std::uint8_t(i % 256), double(k) * 2});
+  }
+
+  eve::algo::radix_sort_by_key(v);
+
+  for( int i = 0; i != 500; ++i )
+  {
+    float k = static_cast<float>(i) - 250.f;
+    TTS_EQUAL(get<0>(v.get(i)), k);
+    TTS_EQUAL(get<2>(v.get(i)), double(k) * 2);
+  }
+};
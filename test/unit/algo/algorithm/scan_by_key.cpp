@@ -0,0 +1,78 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/scan_by_key.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+  // Scalar reference: the sum restarts at every start of a segment.
+  template<typename T, typename Op>
+  std::vector<T> segmented_reference(std::vector<bool> const& starts, std::vector<T> v, Op op)
+  {
+    for( std::size_t i = 1; i < v.size(); ++i )
+    {
+      if( !starts[i] ) v[i] = op(v[i], v[i - 1]);
+    }
+    return v;
+  }
+}
+
+TTS_CASE_TPL("Check inclusive_scan_by_key", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937                       g(11);
+  std::uniform_int_distribution<int> value(0, 3);
+
+  for( int size : {0, 1, 2, 7, 33, 64, 100} )
+  {
+    for( double p : {0.0, 0.1, 0.5, 1.0} )
+    {
+      std::bernoulli_distribution new_key(p);
+
+      std::vector<int> keys(size);
+      std::vector<e_t> values(size);
+      std::vector<bool> starts(size);
+
+      int key = 0;
+      for( int i = 0; i != size; ++i )
+      {
+        starts[i] = i == 0 || new_key(g);
+        key += starts[i] && i != 0;
+        keys[i]   = key;
+        values[i] = static_cast<e_t>(value(g));
+      }
+
+      auto plus = [](e_t a, e_t b) { return static_cast<e_t>(a + b); };
+      auto max  = [](e_t a, e_t b) { return std::max(a, b); };
+
+      std::vector<e_t> actual(size);
+      eve::algo::inclusive_scan_by_key_to[eve::algo::force_cardinal<T::size()>](keys, values, actual);
+      TTS_EQUAL(actual, segmented_reference(starts, values, plus));
+
+      eve::algo::inclusive_scan_by_key_to[eve::algo::force_cardinal<T::size()>](keys, values, actual,
+                                                                                   std::pair{eve::max, eve::valmin});
+      TTS_EQUAL(actual, segmented_reference(starts, values, max));
+
+      std::vector<int> flags(starts.begin(), starts.end());
+      std::vector<e_t> inplace = values;
+      eve::algo::segmented_inclusive_scan_inplace[eve::algo::force_cardinal<T::size()>](flags, inplace);
+      TTS_EQUAL(inplace, segmented_reference(starts, values, plus));
+
+      inplace = values;
+      eve::algo::inclusive_scan_by_key_inplace(keys, inplace);
+      TTS_EQUAL(inplace, segmented_reference(starts, values, plus));
+    }
+  }
+};
@@ -0,0 +1,70 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/search.hpp>
+
+#include <eve/algo/as_range.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TTS_CASE_TPL("Check search", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::search[eve::algo::force_cardinal<T::size()>];
+
+  std::mt19937                    g(3);
+  std::uniform_int_distribution<> letter(0, 2);  // small alphabet: plenty of partial matches
+
+  for( int size : {0, 1, 2, 5, (int)T::size(), 3 * (int)T::size() + 1, 100} )
+  {
+    std::vector<e_t> haystack(size);
+    for( auto& x : haystack ) x = static_cast<e_t>(letter(g));
+
+    for( int m : {0, 1, 2, 3, 4, 5, 6, 9, 17} )
+    {
+      for( int attempt = 0; attempt != 4; ++attempt )
+      {
+        std::vector<e_t> needle(m);
+        if( attempt % 2 == 0 && m <= size )
+        {
+          // a piece of the haystack, guaranteed to be found
+          int from = std::uniform_int_distribution<>(0, size - m)(g);
+          std::copy(haystack.begin() + from, haystack.begin() + from + m, needle.begin());
+        }
+        else
+        {
+          for( auto& x : needle ) x = static_cast<e_t>(letter(g));
+        }
+
+        auto expected = std::search(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+        auto actual   = alg(haystack, needle);
+
+        TTS_EQUAL(actual - haystack.begin(), expected - haystack.begin());
+      }
+    }
+  }
+};
+
+TTS_CASE("Check search, needle at the very end")
+{
+  std::vector<std::uint8_t> haystack(1000, 'a');
+  std::vector<std::uint8_t> needle {'a', 'b', 'c', 'b', 'a'};
+  std::copy(needle.begin(), needle.end(), haystack.end() - 5);
+
+  for( std::size_t m = 1; m <= needle.size(); ++m )
+  {
+    auto n = eve::algo::as_range(needle.data() + needle.size() - m, needle.data() + needle.size());
+    if( m == 1 ) TTS_EQUAL(eve::algo::search(haystack, n) - haystack.begin(), 0);
+    else         TTS_EQUAL(eve::algo::search(haystack, n) - haystack.begin(), (std::ptrdiff_t)(1000 - m));
+  }
+};
@@ -0,0 +1,91 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/set_operations.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace
+{
+  // Strictly increasing values of [0, universe), each one kept with probability `density`
+  template<typename T>
+  std::vector<T> random_set(std::mt19937& g, int universe, double density)
+  {
+    std::bernoulli_distribution keep(density);
+    std::vector<T>              res;
+    for( int v = 0; v != universe; ++v ) if( keep(g) ) res.push_back(static_cast<T>(v));
+    return res;
+  }
+
+  template<typename T, typename Alg, typename Std>
+  void check_set_operation(Alg alg, Std std_alg)
+  {
+    std::mt19937 g(7);
+
+    for( int universe : {0, 1, 5, 20, 64, 120} )
+    {
+      for( double d1 : {0.1, 0.5, 0.9, 1.0} )
+      {
+        for( double d2 : {0.0, 0.3, 0.7, 1.0} )
+        {
+          auto a = random_set<T>(g, universe, d1);
+          auto b = random_set<T>(g, universe, d2);
+
+          std::vector<T> expected;
+          std_alg(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+
+          // exactly the size needed: writing past the end is caught by sanitizers
+          std::vector<T> out(expected.size());
+          auto end = alg(a, b, out.data());
+
+          TTS_EQUAL(end - out.data(), (std::ptrdiff_t)expected.size());
+          TTS_EQUAL(out, expected);
+        }
+      }
+    }
+  }
+}
+
+TTS_CASE_TPL("Check set_intersection", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+  check_set_operation<e_t>(eve::algo::set_intersection[eve::algo::force_cardinal<T::size()>],
+                           [](auto... args) { return std::set_intersection(args...); });
+};
+
+TTS_CASE_TPL("Check set_difference", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+  check_set_operation<e_t>(eve::algo::set_difference[eve::algo::force_cardinal<T::size()>],
+                           [](auto... args) { return std::set_difference(args...); });
+};
+
+TTS_CASE_TPL("Check set_union", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+  check_set_operation<e_t>(eve::algo::set_union[eve::algo::force_cardinal<T::size()>],
+                           [](auto... args) { return std::set_union(args...); });
+};
+
+TTS_CASE("Check set_intersection, converting output")
+{
+  std::vector<std::uint32_t> a {1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144};
+  std::vector<std::uint32_t> b {0, 2, 4, 6, 8, 10, 12, 14, 16, 36, 64, 100, 144};
+  std::vector<std::uint64_t> out(6);
+
+  auto end = eve::algo::set_intersection(a, b, out.begin());
+  TTS_EXPECT(end == out.end());
+  TTS_EQUAL(out, (std::vector<std::uint64_t> {4, 16, 36, 64, 100, 144}));
+};
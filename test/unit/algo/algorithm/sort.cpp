@@ -0,0 +1,154 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/container/soa_vector.hpp>
+#include <eve/algo/sort.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TTS_CASE_TPL("Check sort_wide", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937 g(T::size());
+  std::uniform_int_distribution<int> d(0, 100);
+
+  for( int i = 0; i != 100; ++i )
+  {
+    std::array<e_t, T::size()> data;
+    for( auto& x : data ) x = static_cast<e_t>(d(g));
+
+    T x(data.begin(), data.end());
+    std::sort(data.begin(), data.end());
+    TTS_EQUAL(eve::algo::detail::sort_wide(x), T(data.begin(), data.end()));
+  }
+};
+
+TTS_CASE_TPL("Check sort", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  std::mt19937 g(17);
+  std::uniform_int_distribution<int> d(0, 120);
+
+  auto alg = eve::algo::sort[eve::algo::force_cardinal<T::size()>];
+
+  for( int size : {0, 1, 2, 3, 5, 16, 31, 64, 100, 127, 128, 129, 1000, 4099} )
+  {
+    for( int offset : {0, 1} )
+    {
+      std::vector<e_t> v(size + offset);
+      for( auto& x : v ) x = static_cast<e_t>(d(g));
+      std::vector<e_t> expected = v;
+      std::sort(expected.begin() + offset, expected.end());
+
+      alg(eve::algo::as_range(v.data() + offset, v.data() + v.size()));
+      TTS_EQUAL(v, expected);
+    }
+  }
+
+  // already sorted, reversed, all equal
+  std::vector<e_t> v(333);
+  for( std::size_t i = 0; i != v.size(); ++i ) v[i] = static_cast<e_t>(i % 100);
+  std::vector<e_t> expected = v;
+  std::sort(expected.begin(), expected.end());
+
+  eve::algo::sort(v);
+  TTS_EQUAL(v, expected);
+
+  eve::algo::sort(v);
+  TTS_EQUAL(v, expected);
+
+  std::reverse(v.begin(), v.end());
+  eve::algo::sort(v);
+  TTS_EQUAL(v, expected);
+
+  std::fill(v.begin(), v.end(), e_t{3});
+  eve::algo::sort(v);
+  TTS_EQUAL(v, std::vector<e_t>(333, e_t{3}));
+};
+
+TTS_CASE("Check sort special values")
+{
+  std::vector<float> v {3.f, eve::inf(eve::as<float>{}), -0.f, eve::minf(eve::as<float>{}), 1.f,
+                        eve::valmax(eve::as<float>{}), eve::inf(eve::as<float>{}), -5.f, 2.f};
+  std::vector<float> expected = v;
+  std::sort(expected.begin(), expected.end());
+  eve::algo::sort(v);
+  TTS_EQUAL(v, expected);
+
+  std::vector<std::uint32_t> u(1000);
+  for( std::size_t i = 0; i != u.size(); ++i ) u[i] = i % 3 ? eve::valmax(eve::as<std::uint32_t>{}) : i;
+  std::vector<std::uint32_t> expected_u = u;
+  std::sort(expected_u.begin(), expected_u.end());
+  eve::algo::sort(u);
+  TTS_EQUAL(u, expected_u);
+};
+
+TTS_CASE_TPL("Check sort_by_key", algo_test::selected_pairs_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+  using K   = kumi::element_t<0, e_t>;
+  using V   = kumi::element_t<1, e_t>;
+
+  std::mt19937 g(3);
+
+  for( int size : {0, 1, 7, 64, 65, 300, 1025} )
+  {
+    // unique keys, so that the result does not depend on stability
+    std::vector<K> keys(size);
+    std::vector<V> values(size);
+    for( int i = 0; i != size; ++i )
+    {
+      keys[i]   = static_cast<K>(i % 100);
+      values[i] = static_cast<V>(i / 100);
+    }
+    std::shuffle(keys.begin(), keys.end(), g);
+    std::vector<K> keys_before = keys;
+    std::vector<V> values_before = values;
+
+    eve::algo::sort_by_key(keys, values);
+
+    TTS_EXPECT(std::is_sorted(keys.begin(), keys.end()));
+
+    std::vector<std::pair<K, V>> expected, actual;
+    for( int i = 0; i != size; ++i )
+    {
+      expected.emplace_back(keys_before[i], values_before[i]);
+      actual.emplace_back(keys[i], values[i]);
+    }
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    TTS_EXPECT(expected == actual);
+  }
+};
+
+TTS_CASE("Check sort_by_key soa_vector")
+{
+  using point = kumi::tuple<std::uint32_t, float, std::int8_t>;
+  eve::algo::soa_vector<point> v;
+  for( int i = 0; i != 200; ++i )
+  {
+    std::uint32_t k = (i * 37) % 200;
+    v.push_back(point {k, float(k) / 2, std::int8_t(k % 128)});
+  }
+
+  eve::algo::sort_by_key(v);
+
+  for( int i = 0; i != 200; ++i )
+  {
+    TTS_EQUAL(v.get(i), (point {std::uint32_t(i), float(i) / 2, std::int8_t(i % 128)}));
+  }
+};
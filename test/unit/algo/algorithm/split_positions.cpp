@@ -0,0 +1,78 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/split_positions.hpp>
+
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+  std::vector<std::uint32_t> split_positions_scalar(std::vector<std::uint8_t> const& in)
+  {
+    std::vector<std::uint32_t> res;
+    bool                       quoted = false;
+    for( std::size_t i = 0; i != in.size(); ++i )
+    {
+      if( in[i] == '"' ) quoted = !quoted;
+      else if( !quoted && (in[i] == ',' || in[i] == '\n') ) res.push_back(i);
+    }
+    return res;
+  }
+
+  template<int N> void check_split_positions()
+  {
+    constexpr eve::algo::byte_classifier separators {',', '\n'};
+    std::string_view                     alphabet = "ab,,\n\"";
+
+    std::mt19937 g(N);
+
+    for( int size : {0, 1, 2, 63, 64, 65, 200, 4095, 4096, 4097, 10000} )
+    {
+      std::vector<std::uint8_t> in(size);
+      for( auto& x : in ) x = alphabet[g() % alphabet.size()];
+
+      auto expected = split_positions_scalar(in);
+
+      std::vector<std::uint32_t> out(size);
+      auto end = eve::algo::split_positions[eve::algo::force_cardinal<N>](in, out.begin(), separators);
+      out.resize(end - out.begin());
+
+      TTS_EQUAL(out, expected);
+    }
+  }
+}
+
+TTS_CASE("Check split_positions")
+{
+  check_split_positions<1>();
+  check_split_positions<4>();
+  check_split_positions<16>();
+  check_split_positions<32>();
+  check_split_positions<64>();
+};
+
+TTS_CASE("Check split_positions, escaped quotes and other quote")
+{
+  constexpr eve::algo::byte_classifier separators {';', '\n'};
+
+  std::string_view          text = "a;\"b;\"\"c\"\";d\";e\n'f;g';h";
+  std::vector<std::uint8_t> in(text.begin(), text.end());
+
+  std::vector<std::uint16_t> out(in.size());
+  auto end = eve::algo::split_positions(in, out.begin(), separators);
+  out.resize(end - out.begin());
+  TTS_EQUAL(out, (std::vector<std::uint16_t> {1, 13, 15, 18, 21}));
+
+  out.resize(in.size());
+  end = eve::algo::split_positions(in, out.begin(), separators, '\'');
+  out.resize(end - out.begin());
+  TTS_EQUAL(out, (std::vector<std::uint16_t> {1, 4, 10, 13, 15, 21}));
+};
@@ -0,0 +1,141 @@
+//==================================================================================================
+/**
+  EVE - Expressive Vector Engine
+  Copyright : EVE Project Contributors
+  SPDX-License-Identifier: BSL-1.0
+**/
+//==================================================================================================
+
+// g++ 11 regression fires __builtin_memmove spurious warnings
+// https://gcc.gnu.org/bugzilla/show_bug.cgi?id=100516
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wstringop-overread"
+#endif
+
+#include "unit/algo/algo_test.hpp"
+
+#include <eve/algo/unique.hpp>
+
+#include <eve/algo/as_range.hpp>
+#include <eve/algo/container/soa_vector.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  // Sorted data with runs of different length, some crossing wide boundaries.
+  template <typename T> std::vector<T> make_runs(int size)
+  {
+    std::vector<T> v(size);
+    int value = 0, left = 1;
+    for( int i = 0; i != size; ++i )
+    {
+      if( !left )
+      {
+        ++value;
+        left = (value * 7) % 11 + 1;
+      }
+      v[i] = static_cast<T>(value % 100);
+      --left;
+    }
+    return v;
+  }
+}
+
+TTS_CASE_TPL("Check unique", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::unique[eve::algo::force_cardinal<T::size()>];
+
+  for( int offset : {0, 1, (int)T::size() - 1} )
+  {
+    for( int size : {0, 1, 2, (int)T::size(), (int)T::size() + 1, 3 * (int)T::size() + 2, 100, 257} )
+    {
+      std::vector<e_t> v = make_runs<e_t>(offset + size);
+      std::vector<e_t> expected = v;
+      auto expected_end = std::unique(expected.begin() + offset, expected.end());
+      expected.erase(expected_end, expected.end());
+
+      auto end = alg(eve::algo::as_range(v.data() + offset, v.data() + v.size()));
+      v.erase(v.begin() + (end - v.data()), v.end());
+      TTS_EQUAL(v, expected);
+    }
+  }
+
+  // all equal, all different
+  std::vector<e_t> same(77, e_t{3});
+  TTS_EQUAL(alg(same) - same.begin(), 1);
+
+  std::vector<e_t> different(77);
+  for( int i = 0; i != 77; ++i ) different[i] = static_cast<e_t>(i);
+  TTS_EQUAL(alg(different) - different.begin(), 77);
+};
+
+TTS_CASE("Check unique with a custom equality")
+{
+  std::vector<int> v {1, 2, 3, 11, 12, 25, 26, 27, 31, 41, 42, 43, 44, 45, 46, 47, 48, 49};
+  auto same_tens = [](auto x, auto y) { return x / 10 == y / 10; };
+  v.erase(eve::algo::unique(v, same_tens), v.end());
+  TTS_EQUAL(v, (std::vector<int> {1, 11, 25, 31, 41}));
+};
+
+TTS_CASE_TPL("Check run_length_encode", algo_test::selected_types)
+<typename T>(tts::type<T>)
+{
+  using e_t = eve::element_type_t<T>;
+
+  auto alg = eve::algo::run_length_encode[eve::algo::force_cardinal<T::size()>];
+
+  for( int offset : {0, 1, (int)T::size() - 1} )
+  {
+    for( int size : {0, 1, 2, (int)T::size(), (int)T::size() + 1, 3 * (int)T::size() + 2, 100, 257} )
+    {
+      std::vector<e_t> in = make_runs<e_t>(offset + size);
+
+      std::vector<e_t>           expected_values;
+      std::vector<std::uint32_t> expected_counts;
+      for( int i = offset; i != (int)in.size(); ++i )
+      {
+        if( i == offset || in[i] != in[i - 1] )
+        {
+          expected_values.push_back(in[i]);
+          expected_counts.push_back(0);
+        }
+        ++expected_counts.back();
+      }
+
+      std::vector<e_t>           values(expected_values.size());
+      std::vector<std::uint32_t> counts(expected_counts.size());
+
+      auto [values_end, counts_end] =
+          alg(eve::algo::as_range(in.data() + offset, in.data() + in.size()), values.data(), counts.data());
+
+      TTS_EQUAL(values_end - values.data(), (std::ptrdiff_t)expected_values.size());
+      TTS_EQUAL(counts_end - counts.data(), (std::ptrdiff_t)expected_counts.size());
+      TTS_EQUAL(values, expected_values);
+      TTS_EQUAL(counts, expected_counts);
+    }
+  }
+};
+
+TTS_CASE("Check run_length_encode soa_vector")
+{
+  std::vector<short> in {5, 5, 5, 7, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10};
+
+  using run = kumi::tuple<short, std::uint32_t>;
+  eve::algo::soa_vector<run> runs(in.size());
+
+  auto end = eve::algo::run_length_encode(in, runs.begin());
+  TTS_EQUAL(end - runs.begin(), 5);
+  runs.resize(end - runs.begin());
+
+  TTS_EQUAL(runs.get(0), (run {5, 3}));
+  TTS_EQUAL(runs.get(1), (run {7, 1}));
+  TTS_EQUAL(runs.get(2), (run {8, 2}));
+  TTS_EQUAL(runs.get(3), (run {9, 16}));
+  TTS_EQUAL(runs.get(4), (run {10, 1}));
+};